@@ -0,0 +1,244 @@
+#ifndef MY_PARALLEL_H
+#define MY_PARALLEL_H
+
+#include <cstddef>      // size_t
+#include <algorithm>    // std::sort, std::inplace_merge
+#include <functional>   // std::plus, std::less
+#include <iterator>     // std::iterator_traits
+#include <optional>     // std::optional
+#include <utility>      // std::move
+#include <vector>
+#include "myThreadPool.h"
+#include "mySort.h"
+#include "../myVector/myVector.h"
+
+// ==========================================================
+// 并行算法：基于 myThreadPool 的 for_each / transform / reduce / inclusive_scan / copy_if / sort
+// ==========================================================
+// 所有算法接受随机访问迭代器（myVector 的迭代器就是 T*），并在 myThreadPool::parallel_for 上实现：
+// 区间切成 grain 个元素一块，相邻块分给同一线程，空闲线程窃取剩余块。
+//
+// grain 参数控制块大小（0 表示自动：每线程约 8 块，且不少于 1024 个元素）：
+//     - 每个元素很便宜时（如加法）块要大，否则调度开销超过计算本身
+//     - 每个元素很贵或代价不均时块要小，窃取才能把负载摊平
+//
+// 1. parallel_reduce / parallel_inclusive_scan 要求 op 满足结合律；各块的部分结果按块顺序合并，
+//    因此对浮点数结果确定（不随线程调度变化），但可能与顺序求和的舍入不同。
+//    各块的部分结果存放在 std::optional 中，与 std::reduce 一样不要求 T 可默认构造。
+// 2. parallel_inclusive_scan 两趟：先并行求各块总和，顺序求块偏移，再并行逐块扫描。
+// 3. parallel_copy_if 两趟：先并行求值谓词并记录每块的命中数，再按前缀偏移并行写出，
+//    输出顺序与顺序版本相同，谓词对每个元素只调用一次。
+// 4. parallel_sort(pool, ...) 把区间切成至多 concurrency() 段并行 std::sort，
+//    再逐轮两两 inplace_merge；与 mySort.h 中每次新建线程的 parallel_sort 不同，线程由池复用。
+
+// ==========================================================
+// for_each / transform
+// ==========================================================
+
+template <typename RandomIt, typename Fn>
+void parallel_for_each(myThreadPool& pool, RandomIt first, RandomIt last, Fn fn, size_t grain = 0) {
+    pool.parallel_for(0, static_cast<size_t>(last - first), grain, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++ i) {
+            fn(first[i]);
+        }
+    });
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename Fn>
+void parallel_for_each(myThreadPool& pool, myVector<T, Alloc, GrowthPolicy>& v, Fn fn, size_t grain = 0) {
+    parallel_for_each(pool, v.begin(), v.end(), fn, grain);
+}
+
+// 输出区间需已有 last - first 个元素；返回写出区间的末尾
+template <typename RandomIt, typename OutIt, typename UnaryOp>
+OutIt parallel_transform(myThreadPool& pool, RandomIt first, RandomIt last, OutIt d_first, UnaryOp op, size_t grain = 0) {
+    size_t n = static_cast<size_t>(last - first);
+    pool.parallel_for(0, n, grain, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++ i) {
+            d_first[i] = op(first[i]);
+        }
+    });
+    return d_first + n;
+}
+
+// ==========================================================
+// reduce
+// ==========================================================
+
+template <typename RandomIt, typename T, typename BinaryOp>
+T parallel_reduce(myThreadPool& pool, RandomIt first, RandomIt last, T init, BinaryOp op, size_t grain = 0) {
+    size_t n = static_cast<size_t>(last - first);
+    if (n == 0) {
+        return init;
+    }
+    if (grain == 0) {
+        grain = pool.default_grain(n);
+    }
+    size_t chunks = (n + grain - 1) / grain;
+    std::vector<std::optional<T>> partial(chunks);
+    pool.parallel_for(0, chunks, 1, [&](size_t clo, size_t chi) {
+        for (size_t c = clo; c < chi; ++ c) {
+            size_t lo = c * grain;
+            size_t hi = (n - lo) < grain ? n : lo + grain;
+            T acc = first[lo];
+            for (size_t i = lo + 1; i < hi; ++ i) {
+                acc = op(std::move(acc), first[i]);
+            }
+            partial[c].emplace(std::move(acc));
+        }
+    });
+    for (size_t c = 0; c < chunks; ++ c) {
+        init = op(std::move(init), std::move(*partial[c]));
+    }
+    return init;
+}
+
+template <typename RandomIt, typename T>
+T parallel_reduce(myThreadPool& pool, RandomIt first, RandomIt last, T init) {
+    return parallel_reduce(pool, first, last, init, std::plus<>());
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename U, typename BinaryOp = std::plus<>>
+U parallel_reduce(myThreadPool& pool, const myVector<T, Alloc, GrowthPolicy>& v, U init,
+                  BinaryOp op = BinaryOp(), size_t grain = 0) {
+    return parallel_reduce(pool, v.begin(), v.end(), init, op, grain);
+}
+
+// ==========================================================
+// inclusive_scan
+// ==========================================================
+
+// 允许原地扫描 (d_first == first)；返回写出区间的末尾
+template <typename RandomIt, typename OutIt, typename BinaryOp = std::plus<>>
+OutIt parallel_inclusive_scan(myThreadPool& pool, RandomIt first, RandomIt last, OutIt d_first,
+                              BinaryOp op = BinaryOp(), size_t grain = 0) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    size_t n = static_cast<size_t>(last - first);
+    if (n == 0) {
+        return d_first;
+    }
+    if (grain == 0) {
+        grain = pool.default_grain(n);
+    }
+    size_t chunks = (n + grain - 1) / grain;
+    auto chunkEnd = [n, grain](size_t lo) { return (n - lo) < grain ? n : lo + grain; };
+
+    // 第一趟：各块总和（最后一块用不到）
+    std::vector<std::optional<T>> offset(chunks);
+    pool.parallel_for(0, chunks - 1, 1, [&](size_t clo, size_t chi) {
+        for (size_t c = clo; c < chi; ++ c) {
+            size_t lo = c * grain, hi = chunkEnd(lo);
+            T acc = first[lo];
+            for (size_t i = lo + 1; i < hi; ++ i) {
+                acc = op(std::move(acc), first[i]);
+            }
+            offset[c].emplace(std::move(acc));
+        }
+    });
+    // 块总和转换为块前缀：offset[c] 为第 c 块之前所有元素的累计（c >= 1 时有效）
+    for (size_t c = chunks - 1; c > 0; -- c) {
+        offset[c] = std::move(offset[c - 1]);
+    }
+    for (size_t c = 2; c < chunks; ++ c) {
+        offset[c] = op(*offset[c - 1], *offset[c]);
+    }
+    // 第二趟：逐块扫描，带上块前缀
+    pool.parallel_for(0, chunks, 1, [&](size_t clo, size_t chi) {
+        for (size_t c = clo; c < chi; ++ c) {
+            size_t lo = c * grain, hi = chunkEnd(lo);
+            T acc = c == 0 ? T(first[lo]) : op(*offset[c], first[lo]);
+            d_first[lo] = acc;
+            for (size_t i = lo + 1; i < hi; ++ i) {
+                acc = op(std::move(acc), first[i]);
+                d_first[i] = acc;
+            }
+        }
+    });
+    return d_first + n;
+}
+
+// ==========================================================
+// copy_if
+// ==========================================================
+
+// 输出区间需足够容纳所有命中元素；返回写出区间的末尾
+template <typename RandomIt, typename OutIt, typename Pred>
+OutIt parallel_copy_if(myThreadPool& pool, RandomIt first, RandomIt last, OutIt d_first, Pred pred, size_t grain = 0) {
+    size_t n = static_cast<size_t>(last - first);
+    if (n == 0) {
+        return d_first;
+    }
+    if (grain == 0) {
+        grain = pool.default_grain(n);
+    }
+    size_t chunks = (n + grain - 1) / grain;
+    auto chunkEnd = [n, grain](size_t lo) { return (n - lo) < grain ? n : lo + grain; };
+
+    myVector<unsigned char> hit;
+    hit.resize_default_init(n);     // 第一趟会写满每个字节
+    std::vector<size_t> count(chunks + 1, 0);
+    pool.parallel_for(0, chunks, 1, [&](size_t clo, size_t chi) {
+        for (size_t c = clo; c < chi; ++ c) {
+            size_t lo = c * grain, hi = chunkEnd(lo);
+            size_t k = 0;
+            for (size_t i = lo; i < hi; ++ i) {
+                bool h = pred(first[i]);
+                hit[i] = h;
+                k += h;
+            }
+            count[c + 1] = k;
+        }
+    });
+    for (size_t c = 1; c <= chunks; ++ c) {
+        count[c] += count[c - 1];
+    }
+    pool.parallel_for(0, chunks, 1, [&](size_t clo, size_t chi) {
+        for (size_t c = clo; c < chi; ++ c) {
+            size_t lo = c * grain, hi = chunkEnd(lo);
+            OutIt out = d_first + count[c];
+            for (size_t i = lo; i < hi; ++ i) {
+                if (hit[i]) {
+                    *out = first[i];
+                    ++ out;
+                }
+            }
+        }
+    });
+    return d_first + count[chunks];
+}
+
+// ==========================================================
+// sort
+// ==========================================================
+
+// grain 为每段的最少元素数，0 时使用 mySortDetail::parallel_grain
+template <typename RandomIt, typename Compare = std::less<>>
+void parallel_sort(myThreadPool& pool, RandomIt first, RandomIt last, Compare comp = Compare(), size_t grain = 0) {
+    size_t n = static_cast<size_t>(last - first);
+    if (grain == 0) {
+        grain = mySortDetail::parallel_grain;
+    }
+    size_t parts = pool.concurrency();
+    if (parts > n / grain) {
+        parts = n / grain;
+    }
+    if (parts < 2) {
+        std::sort(first, last, comp);
+        return;
+    }
+    // 与 mySort.h 的 parallel_sort 共用切段 / 归并骨架，只是每轮的任务交给线程池
+    mySortDetail::sort_and_merge(first, n, parts, comp, [&pool](size_t count, auto& task) {
+        pool.parallel_for(0, count, 1, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; ++ i) {
+                task(i);
+            }
+        });
+    });
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename Compare = std::less<>>
+void parallel_sort(myThreadPool& pool, myVector<T, Alloc, GrowthPolicy>& v, Compare comp = Compare(), size_t grain = 0) {
+    parallel_sort(pool, v.begin(), v.end(), comp, grain);
+}
+
+#endif // MY_PARALLEL_H
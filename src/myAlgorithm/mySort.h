@@ -0,0 +1,246 @@
+#ifndef MY_SORT_H
+#define MY_SORT_H
+
+#include <cstddef>      // size_t
+#include <cstring>      // std::memcpy
+#include <algorithm>    // std::sort, std::stable_sort, std::inplace_merge
+#include <functional>   // std::less
+#include <memory>       // std::allocator, std::allocator_traits
+#include <thread>       // std::thread
+#include <exception>    // std::exception_ptr
+#include <type_traits>  // std::is_integral, std::make_unsigned, std::invoke_result_t
+#include <vector>
+#include "../myVector/myVector.h"
+
+// ==========================================================
+// 排序算法：基数排序与多线程并行排序
+// ==========================================================
+// 1. radix_sort(first, last [, alloc])
+//    LSD 基数排序，适用于整数元素。每趟按 8 bit 分桶，共 sizeof(Key) 趟：
+//        - 一次扫描同时统计所有趟的直方图
+//        - 某一趟所有元素落在同一个桶时直接跳过（如小范围的 int 只需 1~2 趟）
+//        - 有符号整数把符号位取反后按无符号比较
+//    需要 N 个元素的临时缓冲区，从传入的分配器（容器版本使用容器自己的分配器）申请，
+//    两块缓冲区来回分散 (scatter)，复杂度 O(N * sizeof(Key))，并且是稳定排序。
+//
+// 2. radix_sort_by_key(first, last, key [, alloc])
+//    对平凡可复制的记录（如 HeavyPOD）按 key(record) 返回的整数排序，记录整体 memcpy 搬运。
+//
+// 3. parallel_sort(first, last [, comp, threads])
+//    把区间切成 threads 段，各段在独立的 std::thread 中 std::sort，
+//    再逐轮两两 inplace_merge（每轮的各次归并同样并行），直到只剩一段。
+//    工作线程中抛出的异常会在全部线程结束后重新抛出。
+//
+// intVector 的迭代器就是 int*，直接调用 radix_sort(v.begin(), v.end()) 即可。
+
+namespace mySortDetail {
+
+// 元素个数较少时基数排序的直方图开销不划算
+constexpr size_t radix_threshold = 256;
+// 每个线程至少分到的元素个数，避免线程创建开销盖过收益
+constexpr size_t parallel_grain = 1 << 15;
+
+// 整数 -> 保序的无符号整数（有符号数翻转符号位）
+template <typename Key>
+std::make_unsigned_t<Key> to_unsigned(Key key) noexcept {
+    using U = std::make_unsigned_t<Key>;
+    U u = static_cast<U>(key);
+    if constexpr (std::is_signed_v<Key>) {
+        u ^= U(1) << (sizeof(U) * 8 - 1);
+    }
+    return u;
+}
+
+// 临时缓冲区（RAII）：从分配器申请未初始化内存，只用于平凡可复制的元素
+template <typename T, typename Alloc>
+class ScratchBuffer {
+    using alloc_type = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+    using traits = std::allocator_traits<alloc_type>;
+public:
+    ScratchBuffer(const Alloc& alloc, size_t n) : _alloc(alloc), _data(traits::allocate(_alloc, n)), _size(n) {}
+    ~ScratchBuffer() { traits::deallocate(_alloc, _data, _size); }
+    ScratchBuffer(const ScratchBuffer&) = delete;
+    ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+    T* data() const noexcept { return _data; }
+
+private:
+    alloc_type _alloc;
+    T* _data;
+    size_t _size;
+};
+
+template <typename T, typename KeyFn, typename Alloc>
+void radix_sort_impl(T* first, T* last, KeyFn& key, const Alloc& alloc) {
+    using Key = std::decay_t<std::invoke_result_t<KeyFn&, const T&>>;
+    static_assert(std::is_integral_v<Key> && !std::is_same_v<Key, bool>, "radix sort key must be an integer");
+    static_assert(std::is_trivially_copyable_v<T>, "radix sort moves elements with memcpy");
+    using U = std::make_unsigned_t<Key>;
+    constexpr size_t passes = sizeof(U);
+
+    size_t n = static_cast<size_t>(last - first);
+    if (n < 2) {
+        return;
+    }
+    if (n < radix_threshold) {
+        std::stable_sort(first, last, [&](const T& a, const T& b) {
+            return to_unsigned(key(a)) < to_unsigned(key(b));
+        });
+        return;
+    }
+
+    // 一次扫描统计所有趟的直方图
+    size_t counts[passes][256] = {};
+    for (size_t i = 0; i < n; ++ i) {
+        U u = to_unsigned(key(first[i]));
+        for (size_t p = 0; p < passes; ++ p) {
+            counts[p][(u >> (p * 8)) & 0xFF] ++;
+        }
+    }
+
+    ScratchBuffer<T, Alloc> scratch(alloc, n);
+    T* src = first;
+    T* dst = scratch.data();
+    U firstKey = to_unsigned(key(first[0]));
+    for (size_t p = 0; p < passes; ++ p) {
+        size_t* count = counts[p];
+        if (count[(firstKey >> (p * 8)) & 0xFF] == n) {
+            continue; // 本趟所有元素同桶，顺序不变
+        }
+        size_t offset[256];
+        size_t sum = 0;
+        for (size_t b = 0; b < 256; ++ b) {
+            offset[b] = sum;
+            sum += count[b];
+        }
+        for (size_t i = 0; i < n; ++ i) {
+            size_t b = (to_unsigned(key(src[i])) >> (p * 8)) & 0xFF;
+            std::memcpy(static_cast<void*>(dst + offset[b] ++), static_cast<const void*>(src + i), sizeof(T));
+        }
+        std::swap(src, dst);
+    }
+    // 奇数趟时结果停在临时缓冲区
+    if (src != first) {
+        std::memcpy(static_cast<void*>(first), static_cast<const void*>(src), n * sizeof(T));
+    }
+}
+
+// 调用 task(0) ... task(count - 1)，其中 count - 1 个在新线程中运行，最后一个在当前线程运行
+template <typename Task>
+void parallel_invoke(size_t count, Task& task) {
+    std::vector<std::exception_ptr> errors(count);
+    std::vector<std::thread> workers;
+    workers.reserve(count);
+    auto guarded = [&](size_t i) {
+        try {
+            task(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+    try {
+        for (size_t i = 0; i + 1 < count; ++ i) {
+            workers.emplace_back(guarded, i);
+        }
+    } catch (...) {
+        // 线程创建失败：等待已启动的线程后再抛出
+        for (std::thread& t : workers) t.join();
+        throw;
+    }
+    guarded(count - 1);
+    for (std::thread& t : workers) t.join();
+    for (std::exception_ptr& e : errors) {
+        if (e) std::rethrow_exception(e);
+    }
+}
+
+// 并行排序的公共骨架：把 [first, first + n) 切成 parts 段各自 std::sort，再逐轮两两 inplace_merge
+// （k 段 -> ceil(k / 2) 段）。run(count, task) 负责并行执行 task(0) ... task(count - 1) 并等待全部完成，
+// 由调用者决定用新线程还是线程池
+template <typename RandomIt, typename Compare, typename Run>
+void sort_and_merge(RandomIt first, size_t n, size_t parts, Compare& comp, Run run) {
+    // 切段：bounds[i] 为第 i 段起点
+    std::vector<size_t> bounds(parts + 1);
+    for (size_t i = 0; i <= parts; ++ i) {
+        bounds[i] = n * i / parts;
+    }
+    auto sortChunk = [&](size_t i) {
+        std::sort(first + bounds[i], first + bounds[i + 1], comp);
+    };
+    run(parts, sortChunk);
+
+    while (bounds.size() > 2) {
+        size_t chunks = bounds.size() - 1;
+        size_t pairs = chunks / 2;
+        auto mergePair = [&](size_t i) {
+            std::inplace_merge(first + bounds[2 * i], first + bounds[2 * i + 1], first + bounds[2 * i + 2], comp);
+        };
+        run(pairs, mergePair);
+        std::vector<size_t> next;
+        next.reserve(pairs + 2);
+        for (size_t i = 0; i < chunks; i += 2) {
+            next.push_back(bounds[i]);
+        }
+        next.push_back(n);
+        bounds.swap(next);
+    }
+}
+
+} // namespace mySortDetail
+
+
+// ==========================================================
+// Radix sort
+// ==========================================================
+
+template <typename T, typename Alloc = std::allocator<T>>
+void radix_sort(T* first, T* last, const Alloc& alloc = Alloc()) {
+    auto identity = [](const T& value) { return value; };
+    mySortDetail::radix_sort_impl(first, last, identity, alloc);
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+void radix_sort(myVector<T, Alloc, GrowthPolicy>& v) {
+    radix_sort(v.begin(), v.end(), v.get_allocator());
+}
+
+template <typename T, typename KeyFn, typename Alloc = std::allocator<T>>
+void radix_sort_by_key(T* first, T* last, KeyFn key, const Alloc& alloc = Alloc()) {
+    mySortDetail::radix_sort_impl(first, last, key, alloc);
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename KeyFn>
+void radix_sort_by_key(myVector<T, Alloc, GrowthPolicy>& v, KeyFn key) {
+    radix_sort_by_key(v.begin(), v.end(), key, v.get_allocator());
+}
+
+// ==========================================================
+// Parallel sort
+// ==========================================================
+
+// threads == 0 时使用硬件线程数
+template <typename RandomIt, typename Compare = std::less<>>
+void parallel_sort(RandomIt first, RandomIt last, Compare comp = Compare(), size_t threads = 0) {
+    size_t n = static_cast<size_t>(last - first);
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    size_t maxThreads = n / mySortDetail::parallel_grain;
+    if (threads > maxThreads) {
+        threads = maxThreads;
+    }
+    if (threads < 2) {
+        std::sort(first, last, comp);
+        return;
+    }
+
+    mySortDetail::sort_and_merge(first, n, threads, comp, [](size_t count, auto& task) {
+        mySortDetail::parallel_invoke(count, task);
+    });
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename Compare = std::less<>>
+void parallel_sort(myVector<T, Alloc, GrowthPolicy>& v, Compare comp = Compare(), size_t threads = 0) {
+    parallel_sort(v.begin(), v.end(), comp, threads);
+}
+
+#endif // MY_SORT_H
@@ -0,0 +1,305 @@
+#ifndef MY_STATIC_SEARCH_H
+#define MY_STATIC_SEARCH_H
+
+#include <cstddef>      // size_t
+#include <cstdint>      // std::uintptr_t, int32_t
+#include <algorithm>    // std::sort, std::is_sorted
+#include <functional>   // std::less
+#include <limits>       // std::numeric_limits
+#include <type_traits>  // std::is_arithmetic_v
+#include "../myVector/myVector.h"
+#include "../myAllocator/myAlignedAllocator.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>  // SSE2：x86-64 基线指令集
+#define MY_STATIC_SEARCH_SSE2 1
+#else
+#define MY_STATIC_SEARCH_SSE2 0
+#endif
+
+// ==========================================================
+// 静态有序数组的缓存友好查找索引
+// ==========================================================
+// 在有序数组上二分查找，前几步访问的位置相距 N/2、N/4 ...，每一步都落在不同的
+// cache line 上；N 很大时每次查找约 log2(N) 次 cache miss，且下一步的地址依赖本步的比较
+// 结果，CPU 无法提前取数。以下两种布局把 "接下来要访问的元素" 放得更近：
+//
+// 1. myEytzingerIndex：Eytzinger (BFS) 布局
+//    按二叉搜索树的层序存放：节点 k 的左右孩子为 2k、2k+1（下标从 1 开始）。
+//        有序数组: [1 2 3 4 5 6 7]   ->   Eytzinger: [_ 4 2 6 1 3 5 7]
+//    节点 k 往下 4 层的 16 个后代恰好是连续的 [16k, 16k + 15]，数组按 64 字节对齐后
+//    正好是一条 cache line，因此每步都预取 4 层之后的那条 cache line，访存延迟与比较重叠。
+//    下降过程没有分支；lower_bound_batch 交错推进多组查询，进一步隐藏延迟。
+//
+// 2. myStaticBTree：静态 B+ 树 (S-tree) 布局
+//    每个节点存 B = 64 / sizeof(T) 个键（一条 cache line），节点 k 的第 i 个孩子为
+//    k * (B + 1) + i + 1。树高降为 log_{B+1}(N)，每层只有一次 cache miss；
+//    节点内用 SIMD 一次比较 16 个 int 求出 "小于 key 的键数"，即下一步走哪个孩子。
+//
+// 两者都只支持构建后只读；查找返回指向索引内部元素的指针，不存在时返回 nullptr。
+
+template <typename T, typename Compare = std::less<T>>
+class myEytzingerIndex {
+private:
+    // 一条 cache line 能放下的元素数，即预取的步长
+    static constexpr size_t line_elems = sizeof(T) >= 64 ? 1 : 64 / sizeof(T);
+    // 同时推进的查询数
+    static constexpr size_t batch_width = 16;
+
+    myVector<T, myAlignedAllocator<T, 64>> _tree;   // _tree[1 .. n]，_tree[0] 不使用
+    size_t _size;
+    size_t _fullLevels;                              // 完全填满的层数 floor(log2(n + 1))
+    Compare _comp;
+
+public:
+    /* ===== 构造 ===== */
+    myEytzingerIndex() : _size(0), _fullLevels(0) {}
+    // 输入未排序时先复制并排序
+    myEytzingerIndex(const T* first, size_t count, const Compare& comp = Compare());
+    template <typename Alloc, typename GrowthPolicy>
+    explicit myEytzingerIndex(const myVector<T, Alloc, GrowthPolicy>& values, const Compare& comp = Compare())
+        : myEytzingerIndex(values.begin(), values.size(), comp) {}
+
+    /* ===== 容量相关 ===== */
+    size_t size() const noexcept { return _size; }
+    bool empty() const noexcept { return _size == 0; }
+    size_t memory_bytes() const noexcept { return _tree.capacity() * sizeof(T); }
+
+    /* ===== 查找 ===== */
+    // 第一个不小于 key 的元素，不存在返回 nullptr
+    const T* lower_bound(const T& key) const noexcept;
+    bool contains(const T& key) const noexcept;
+    // out[i] = lower_bound(keys[i])
+    void lower_bound_batch(const T* keys, size_t count, const T** out) const noexcept;
+
+private:
+    /* ===== 内部工具 ===== */
+    size_t build(const T* sorted, size_t i, size_t k);
+    void prefetch(size_t k) const noexcept;
+    const T* resolve(size_t k) const noexcept;
+};
+
+template <typename T>
+class myStaticBTree {
+    static_assert(std::is_arithmetic_v<T>, "myStaticBTree requires an arithmetic key type");
+public:
+    static constexpr size_t node_keys = sizeof(T) >= 64 ? 1 : 64 / sizeof(T);
+
+private:
+    myVector<T, myAlignedAllocator<T, 64>> _nodes;  // 每 node_keys 个为一个节点
+    size_t _size;
+    size_t _blocks;                                  // 节点数
+    T _max;                                          // 最大的真实键（末尾用 numeric_limits::max 填充）
+
+public:
+    /* ===== 构造 ===== */
+    myStaticBTree() : _size(0), _blocks(0), _max() {}
+    myStaticBTree(const T* first, size_t count);
+    template <typename Alloc, typename GrowthPolicy>
+    explicit myStaticBTree(const myVector<T, Alloc, GrowthPolicy>& values)
+        : myStaticBTree(values.begin(), values.size()) {}
+
+    /* ===== 容量相关 ===== */
+    size_t size() const noexcept { return _size; }
+    bool empty() const noexcept { return _size == 0; }
+    size_t memory_bytes() const noexcept { return _nodes.capacity() * sizeof(T); }
+
+    /* ===== 查找 ===== */
+    const T* lower_bound(const T& key) const noexcept;
+    bool contains(const T& key) const noexcept;
+
+private:
+    /* ===== 内部工具 ===== */
+    static size_t child(size_t k, size_t i) noexcept { return k * (node_keys + 1) + i + 1; }
+    static size_t rank(const T* node, const T& key) noexcept;
+    void build(const T* sorted, size_t& t, size_t k);
+};
+
+
+// ==========================================================
+// Implementation - myEytzingerIndex
+// ==========================================================
+
+template <typename T, typename Compare>
+myEytzingerIndex<T, Compare>::myEytzingerIndex(const T* first, size_t count, const Compare& comp)
+    : _size(count), _fullLevels(0), _comp(comp) {
+    myVector<T> sorted;
+    if (!std::is_sorted(first, first + count, _comp)) {
+        sorted.assign(first, first + count);
+        std::sort(sorted.begin(), sorted.end(), _comp);
+        first = sorted.begin();
+    }
+    _tree.resize(count + 1);
+    build(first, 0, 1);
+    while ((size_t(1) << (_fullLevels + 1)) - 1 <= count) {
+        _fullLevels ++;
+    }
+}
+
+// 中序遍历隐式二叉树，依次填入有序元素
+template <typename T, typename Compare>
+size_t myEytzingerIndex<T, Compare>::build(const T* sorted, size_t i, size_t k) {
+    if (k <= _size) {
+        i = build(sorted, i, 2 * k);
+        _tree[k] = sorted[i ++];
+        i = build(sorted, i, 2 * k + 1);
+    }
+    return i;
+}
+
+template <typename T, typename Compare>
+void myEytzingerIndex<T, Compare>::prefetch(size_t k) const noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    // 只是提示，越界地址不会触发异常；用整数运算避免越界指针算术
+    std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(_tree.begin()) + k * line_elems * sizeof(T);
+    __builtin_prefetch(reinterpret_cast<const void*>(addr));
+#else
+    (void)k;
+#endif
+}
+
+// 下降结束时 k 的二进制为 "答案节点 + 1 + 若干个 0"：去掉末尾的 1 和其后所有 0
+template <typename T, typename Compare>
+const T* myEytzingerIndex<T, Compare>::resolve(size_t k) const noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    k >>= __builtin_ctzll(~static_cast<unsigned long long>(k)) + 1;
+#else
+    while (k & 1) k >>= 1;
+    k >>= 1;
+#endif
+    return k == 0 ? nullptr : &_tree[k];
+}
+
+template <typename T, typename Compare>
+const T* myEytzingerIndex<T, Compare>::lower_bound(const T& key) const noexcept {
+    size_t k = 1;
+    for (size_t level = 0; level < _fullLevels; ++ level) {
+        prefetch(k);
+        k = 2 * k + (_comp(_tree[k], key) ? 1 : 0);
+    }
+    // 最后一层未填满
+    if (k <= _size) {
+        k = 2 * k + (_comp(_tree[k], key) ? 1 : 0);
+    }
+    return resolve(k);
+}
+
+template <typename T, typename Compare>
+bool myEytzingerIndex<T, Compare>::contains(const T& key) const noexcept {
+    const T* p = lower_bound(key);
+    return p != nullptr && !_comp(key, *p);
+}
+
+// 每次同时推进 batch_width 个查询：同一层的多次访存相互独立，可以并发等待
+template <typename T, typename Compare>
+void myEytzingerIndex<T, Compare>::lower_bound_batch(const T* keys, size_t count, const T** out) const noexcept {
+    size_t k[batch_width];
+    for (size_t base = 0; base < count; base += batch_width) {
+        size_t m = count - base < batch_width ? count - base : batch_width;
+        const T* group = keys + base;
+        for (size_t g = 0; g < m; ++ g) {
+            k[g] = 1;
+        }
+        for (size_t level = 0; level < _fullLevels; ++ level) {
+            for (size_t g = 0; g < m; ++ g) {
+                prefetch(k[g]);
+                k[g] = 2 * k[g] + (_comp(_tree[k[g]], group[g]) ? 1 : 0);
+            }
+        }
+        for (size_t g = 0; g < m; ++ g) {
+            if (k[g] <= _size) {
+                k[g] = 2 * k[g] + (_comp(_tree[k[g]], group[g]) ? 1 : 0);
+            }
+            out[base + g] = resolve(k[g]);
+        }
+    }
+}
+
+// ==========================================================
+// Implementation - myStaticBTree
+// ==========================================================
+
+template <typename T>
+myStaticBTree<T>::myStaticBTree(const T* first, size_t count) : _size(count), _blocks(0), _max() {
+    myVector<T> sorted;
+    if (!std::is_sorted(first, first + count)) {
+        sorted.assign(first, first + count);
+        std::sort(sorted.begin(), sorted.end());
+        first = sorted.begin();
+    }
+    if (count == 0) {
+        return;
+    }
+    _max = first[count - 1];
+    _blocks = (count + node_keys - 1) / node_keys;
+    _nodes.resize(_blocks * node_keys);
+    size_t t = 0;
+    build(first, t, 0);
+}
+
+// 中序遍历隐式 (B + 1) 叉树，真实键用完后以最大值填充
+template <typename T>
+void myStaticBTree<T>::build(const T* sorted, size_t& t, size_t k) {
+    if (k >= _blocks) {
+        return;
+    }
+    for (size_t i = 0; i < node_keys; ++ i) {
+        build(sorted, t, child(k, i));
+        _nodes[k * node_keys + i] = t < _size ? sorted[t] : std::numeric_limits<T>::max();
+        t ++;
+    }
+    build(sorted, t, child(k, node_keys));
+}
+
+// 节点内小于 key 的键数（节点有序，即第一个 >= key 的位置）
+template <typename T>
+size_t myStaticBTree<T>::rank(const T* node, const T& key) noexcept {
+#if MY_STATIC_SEARCH_SSE2
+    if constexpr (std::is_same_v<T, int32_t> && node_keys == 16) {
+        const __m128i* p = reinterpret_cast<const __m128i*>(node);  // 节点按 64 字节对齐
+        __m128i x = _mm_set1_epi32(key);
+        __m128i c0 = _mm_cmpgt_epi32(x, _mm_load_si128(p + 0));
+        __m128i c1 = _mm_cmpgt_epi32(x, _mm_load_si128(p + 1));
+        __m128i c2 = _mm_cmpgt_epi32(x, _mm_load_si128(p + 2));
+        __m128i c3 = _mm_cmpgt_epi32(x, _mm_load_si128(p + 3));
+        // 16 个 32 位比较结果压成 16 个字节，再取每字节最高位
+        __m128i packed = _mm_packs_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(packed));
+        return static_cast<size_t>(__builtin_ctz(~mask));
+    }
+#endif
+    size_t i = 0;
+    for (size_t j = 0; j < node_keys; ++ j) {
+        i += node[j] < key ? 1 : 0;
+    }
+    return i;
+}
+
+template <typename T>
+const T* myStaticBTree<T>::lower_bound(const T& key) const noexcept {
+    // key 大于所有真实键时不存在答案；否则答案一定是真实键（填充值排在所有真实键之后）
+    if (_size == 0 || _max < key) {
+        return nullptr;
+    }
+    const T* result = nullptr;
+    size_t k = 0;
+    while (k < _blocks) {
+        const T* node = _nodes.begin() + k * node_keys;
+        size_t i = rank(node, key);
+        if (i < node_keys) {
+            result = node + i;
+        }
+        k = child(k, i);
+    }
+    return result;
+}
+
+template <typename T>
+bool myStaticBTree<T>::contains(const T& key) const noexcept {
+    const T* p = lower_bound(key);
+    return p != nullptr && !(key < *p);
+}
+
+#undef MY_STATIC_SEARCH_SSE2
+
+#endif // MY_STATIC_SEARCH_H
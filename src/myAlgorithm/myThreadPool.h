@@ -0,0 +1,271 @@
+#ifndef MY_THREAD_POOL_H
+#define MY_THREAD_POOL_H
+
+#include <cstddef>              // size_t
+#include <atomic>               // std::atomic
+#include <condition_variable>   // std::condition_variable
+#include <deque>                // std::deque
+#include <exception>            // std::exception_ptr
+#include <functional>           // std::function
+#include <memory>               // std::unique_ptr
+#include <mutex>                // std::mutex
+#include <thread>               // std::thread
+#include <utility>              // std::forward
+#include <vector>
+
+// ==========================================================
+// myThreadPool：工作窃取 (work-stealing) 线程池
+// ==========================================================
+// 每个工作线程有自己的任务队列：
+//     - 自己从队尾取（LIFO，刚拆出的任务数据还在缓存里）
+//     - 空闲时从其它线程的队头偷（FIFO，偷走的是最早、通常最大块的任务）
+// 队列各自加锁且按 cache line 对齐，线程之间几乎不争用同一把锁。
+//
+// parallel_for(begin, end, grain, body) 是所有并行算法的基础：
+//     - 区间按 grain 切块，连续的块分给同一个线程（相邻数据留在同一个核的缓存）
+//     - 负载不均时由窃取自动平衡
+//     - 调用线程在等待期间也执行任务（因此在任务内部嵌套调用 parallel_for 不会死锁）
+//     - 任一块抛出的异常在所有块结束后重新抛出
+//
+// 线程数为 0 时所有任务都由调用线程执行，便于对比单线程基线。
+
+class myThreadPool {
+public:
+    using Task = std::function<void()>;
+
+    explicit myThreadPool(size_t threads = std::thread::hardware_concurrency());
+    ~myThreadPool();
+    myThreadPool(const myThreadPool&) = delete;
+    myThreadPool& operator=(const myThreadPool&) = delete;
+
+    // 工作线程数（不含调用线程）
+    size_t size() const noexcept { return _workers.size(); }
+    // 参与计算的线程数（工作线程 + 等待中的调用线程）
+    size_t concurrency() const noexcept { return _workers.size() + 1; }
+
+    // 提交一个独立任务
+    void submit(Task task);
+    // 对 [begin, end) 按 grain 切块并行执行 body(lo, hi)，阻塞直到全部完成；grain 为 0 时自动选择
+    template <typename Body>
+    void parallel_for(size_t begin, size_t end, size_t grain, Body&& body);
+    // 取出并执行一个待处理任务，没有任务时返回 false
+    bool run_one();
+
+    // grain 为 0 时的默认块大小：每个线程约 8 块，且不小于 min_grain
+    size_t default_grain(size_t n, size_t min_grain = 1024) const noexcept;
+
+private:
+    struct alignas(64) WorkQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::thread> _workers;
+    std::unique_ptr<WorkQueue[]> _queues;
+    size_t _queueCount;
+    std::atomic<size_t> _pending;       // 所有队列中的任务总数
+    std::atomic<size_t> _nextQueue;     // 外部提交时轮询的队列
+    std::mutex _sleepMutex;
+    std::condition_variable _wake;
+    bool _stop;
+
+    void worker_loop(size_t index);
+    void push(size_t queue, Task task);
+    bool pop_local(size_t queue, Task& task);
+    bool steal(size_t thief, Task& task);
+    size_t current_queue() const noexcept;
+    static myThreadPool*& tls_pool() noexcept;
+    static size_t& tls_index() noexcept;
+};
+
+
+// ==========================================================
+// Implementation - Lifecycle
+// ==========================================================
+
+inline myThreadPool::myThreadPool(size_t threads)
+    : _queues(new WorkQueue[threads == 0 ? 1 : threads]), _queueCount(threads == 0 ? 1 : threads),
+      _pending(0), _nextQueue(0), _stop(false) {
+    _workers.reserve(threads);
+    try {
+        for (size_t i = 0; i < threads; ++ i) {
+            _workers.emplace_back(&myThreadPool::worker_loop, this, i);
+        }
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (std::thread& t : _workers) t.join();
+        throw;
+    }
+}
+
+// 先执行完所有已提交的任务，再结束线程
+inline myThreadPool::~myThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _stop = true;
+    }
+    _wake.notify_all();
+    for (std::thread& t : _workers) {
+        t.join();
+    }
+    while (run_one()) {}
+}
+
+// ==========================================================
+// Implementation - Scheduling
+// ==========================================================
+
+inline void myThreadPool::submit(Task task) {
+    size_t queue = current_queue();
+    if (queue == _queueCount) {
+        queue = _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queueCount;
+    }
+    push(queue, std::move(task));
+}
+
+inline bool myThreadPool::run_one() {
+    size_t queue = current_queue();
+    Task task;
+    if ((queue < _queueCount && pop_local(queue, task)) || steal(queue, task)) {
+        task();
+        return true;
+    }
+    return false;
+}
+
+inline size_t myThreadPool::default_grain(size_t n, size_t min_grain) const noexcept {
+    size_t grain = n / (concurrency() * 8);
+    return grain < min_grain ? min_grain : grain;
+}
+
+template <typename Body>
+void myThreadPool::parallel_for(size_t begin, size_t end, size_t grain, Body&& body) {
+    if (begin >= end) {
+        return;
+    }
+    size_t n = end - begin;
+    if (grain == 0) {
+        grain = default_grain(n);
+    }
+    size_t chunks = (n + grain - 1) / grain;
+    if (chunks == 1 || _workers.empty()) {
+        body(begin, end);
+        return;
+    }
+
+    std::atomic<size_t> remaining(chunks);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto runChunk = [&, begin, end, grain](size_t c) {
+        size_t lo = begin + c * grain;
+        size_t hi = (end - lo) < grain ? end : lo + grain;
+        try {
+            body(lo, hi);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) error = std::current_exception();
+        }
+        remaining.fetch_sub(1, std::memory_order_acq_rel);
+    };
+
+    // 第 0 块留给调用线程；其余按连续区段分给各队列
+    for (size_t c = 1; c < chunks; ++ c) {
+        size_t queue = (c - 1) * _queueCount / (chunks - 1);
+        push(queue, [runChunk, c]() { runChunk(c); });
+    }
+    runChunk(0);
+    // 等待期间帮忙执行任务（可能是本次的块，也可能是其它并行调用的块）
+    while (remaining.load(std::memory_order_acquire) != 0) {
+        if (!run_one()) {
+            std::this_thread::yield();
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// ==========================================================
+// Implementation - Internal Tools
+// ==========================================================
+
+inline void myThreadPool::worker_loop(size_t index) {
+    tls_pool() = this;
+    tls_index() = index;
+    Task task;
+    for (;;) {
+        if (pop_local(index, task) || steal(index, task)) {
+            task();
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _wake.wait(lock, [this] { return _stop || _pending.load(std::memory_order_acquire) > 0; });
+        if (_stop && _pending.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+inline void myThreadPool::push(size_t queue, Task task) {
+    {
+        std::lock_guard<std::mutex> lock(_queues[queue].mutex);
+        _queues[queue].tasks.push_back(std::move(task));
+    }
+    {
+        // 与 worker 的 "检查 _pending -> 睡眠" 串行化，避免丢失唤醒
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _pending.fetch_add(1, std::memory_order_release);
+    }
+    _wake.notify_one();
+}
+
+inline bool myThreadPool::pop_local(size_t queue, Task& task) {
+    std::lock_guard<std::mutex> lock(_queues[queue].mutex);
+    if (_queues[queue].tasks.empty()) {
+        return false;
+    }
+    task = std::move(_queues[queue].tasks.back());
+    _queues[queue].tasks.pop_back();
+    _pending.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+inline bool myThreadPool::steal(size_t thief, Task& task) {
+    if (_pending.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+    size_t start = thief < _queueCount ? thief + 1 : 0;
+    for (size_t i = 0; i < _queueCount; ++ i) {
+        size_t victim = (start + i) % _queueCount;
+        std::lock_guard<std::mutex> lock(_queues[victim].mutex);
+        if (!_queues[victim].tasks.empty()) {
+            task = std::move(_queues[victim].tasks.front());
+            _queues[victim].tasks.pop_front();
+            _pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+// 当前线程是本池的工作线程时返回其队列下标，否则返回 _queueCount
+inline size_t myThreadPool::current_queue() const noexcept {
+    return tls_pool() == this ? tls_index() : _queueCount;
+}
+
+inline myThreadPool*& myThreadPool::tls_pool() noexcept {
+    static thread_local myThreadPool* pool = nullptr;
+    return pool;
+}
+
+inline size_t& myThreadPool::tls_index() noexcept {
+    static thread_local size_t index = 0;
+    return index;
+}
+
+#endif // MY_THREAD_POOL_H
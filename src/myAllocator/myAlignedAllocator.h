@@ -0,0 +1,47 @@
+#ifndef MY_ALIGNED_ALLOCATOR_H
+#define MY_ALIGNED_ALLOCATOR_H
+
+#include <cstddef>      // size_t
+#include <new>          // ::operator new(size_t, std::align_val_t)
+#include <type_traits>  // std::true_type
+
+// ==========================================================
+// myAlignedAllocator：按 Align 字节对齐的分配器
+// ==========================================================
+// std::allocator 只保证 alignof(std::max_align_t)（通常 16 字节）。
+// 当数据结构依赖 "某段元素恰好落在同一条 cache line" 时（如 Eytzinger 布局的预取、
+// 每个节点占一条 cache line 的 S-tree），需要把数组起点对齐到 64 字节。
+// 基于 C++17 的对齐 operator new 实现；无状态，所有实例相等。
+
+template <typename T, size_t Align = 64>
+struct myAlignedAllocator {
+    static_assert((Align & (Align - 1)) == 0, "Align must be a power of two");
+    static_assert(Align >= alignof(T), "Align must not be weaker than alignof(T)");
+
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    // 非类型模板参数无法被 allocator_traits 自动 rebind
+    template <typename U>
+    struct rebind {
+        using other = myAlignedAllocator<U, Align>;
+    };
+
+    myAlignedAllocator() = default;
+    template <typename U> myAlignedAllocator(const myAlignedAllocator<U, Align>&) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+    }
+
+    void deallocate(T* p, size_t /*n*/) noexcept {
+        ::operator delete(p, std::align_val_t(Align));
+    }
+};
+
+template <typename T, typename U, size_t Align>
+bool operator==(const myAlignedAllocator<T, Align>&, const myAlignedAllocator<U, Align>&) { return true; }
+template <typename T, typename U, size_t Align>
+bool operator!=(const myAlignedAllocator<T, Align>&, const myAlignedAllocator<U, Align>&) { return false; }
+
+#endif // MY_ALIGNED_ALLOCATOR_H
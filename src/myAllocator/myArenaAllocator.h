@@ -0,0 +1,115 @@
+#ifndef MY_ARENA_ALLOCATOR_H
+#define MY_ARENA_ALLOCATOR_H
+
+#include <cstddef>      // size_t, std::max_align_t
+#include <cstdint>      // std::uintptr_t
+#include <new>          // ::operator new, std::bad_alloc
+#include <type_traits>  // std::true_type
+
+// ==========================================================
+// myArena + myArenaAllocator：单调 (monotonic) 内存竞技场
+// ==========================================================
+// myArena 按块向系统申请内存，分配时只移动 bump 指针，
+// 单个对象的 deallocate 是空操作，所有内存在 release() 或析构时一次性归还。
+//
+//  block ──► ┌───────────────┬──────────────────┐
+//            │     used      │      free        │
+//            └───────────────┴──────────────────┘
+//                            ▲ _cur            ▲ _end
+//
+// 适用场景：生命周期一致的一批容器（一次请求、一帧、一次批处理），
+// 代价是 vector 扩容留下的旧块在 release() 之前不会被复用。
+//
+// myArenaAllocator<T> 只持有 myArena* （非拥有），是一个有状态分配器：
+//     - 指向同一 myArena 的两个分配器相等
+//     - propagate_on_container_* 均为 true：容器赋值/交换时分配器跟随元素走，
+//       保证内存始终由申请它的竞技场负责
+
+class myArena {
+private:
+    struct Block {
+        Block* next;
+        size_t size;
+    };
+    Block*  _blocks;     // 已申请的块（单链表，头插）
+    char*   _cur;        // 当前块的 bump 指针
+    char*   _end;        // 当前块的末尾
+    size_t  _blockSize;  // 常规块大小
+    size_t  _used;       // 已分配给用户的字节数
+
+public:
+    explicit myArena(size_t blockSize = 64 * 1024)
+        : _blocks(nullptr), _cur(nullptr), _end(nullptr), _blockSize(blockSize), _used(0) {}
+    ~myArena() { release(); }
+    myArena(const myArena&) = delete;
+    myArena& operator=(const myArena&) = delete;
+
+    void* allocate(size_t bytes, size_t align) {
+        char* p = align_up(_cur, align);
+        if (_cur == nullptr || p + bytes > _end) {
+            // 当前块不够：申请新块，超大请求单独成块
+            size_t need = bytes + align + sizeof(Block);
+            new_block(need > _blockSize ? need : _blockSize);
+            p = align_up(_cur, align);
+        }
+        _cur = p + bytes;
+        _used += bytes;
+        return p;
+    }
+
+    // 归还所有块（批量释放），之前分配的所有指针全部失效
+    void release() noexcept {
+        while (_blocks != nullptr) {
+            Block* next = _blocks->next;
+            ::operator delete(_blocks);
+            _blocks = next;
+        }
+        _cur = _end = nullptr;
+        _used = 0;
+    }
+
+    size_t bytes_used() const noexcept { return _used; }
+
+private:
+    static char* align_up(char* p, size_t align) {
+        std::uintptr_t v = reinterpret_cast<std::uintptr_t>(p);
+        return reinterpret_cast<char*>((v + align - 1) & ~(std::uintptr_t(align) - 1));
+    }
+
+    void new_block(size_t size) {
+        Block* b = static_cast<Block*>(::operator new(size));
+        b->next = _blocks;
+        b->size = size;
+        _blocks = b;
+        _cur = reinterpret_cast<char*>(b + 1);
+        _end = reinterpret_cast<char*>(b) + size;
+    }
+};
+
+template <typename T>
+struct myArenaAllocator {
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    myArena* arena;
+
+    explicit myArenaAllocator(myArena& a) noexcept : arena(&a) {}
+    template <typename U> myArenaAllocator(const myArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {
+        // 单调竞技场：单个释放为空操作，由 myArena::release() 统一回收
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const myArenaAllocator<T>& a, const myArenaAllocator<U>& b) { return a.arena == b.arena; }
+template <typename T, typename U>
+bool operator!=(const myArenaAllocator<T>& a, const myArenaAllocator<U>& b) { return a.arena != b.arena; }
+
+#endif // MY_ARENA_ALLOCATOR_H
@@ -0,0 +1,86 @@
+#ifndef MY_HUGE_PAGE_ALLOCATOR_H
+#define MY_HUGE_PAGE_ALLOCATOR_H
+
+#include <cstddef>      // size_t
+#include <cstdint>      // std::uintptr_t
+#include <new>          // ::operator new, std::bad_alloc
+#include <type_traits>  // std::true_type
+
+#if defined(__linux__)
+#include <sys/mman.h>   // mmap, munmap, madvise
+#endif
+
+// ==========================================================
+// myHugePageAllocator：透明大页 (Transparent Huge Page) 分配器
+// ==========================================================
+// 4KB 页下，随机访问一个 1GB 的数组需要 262144 个 TLB 表项，TLB 几乎每次都未命中；
+// 2MB 大页只需要 512 个表项。本分配器对大块内存：
+//     1. mmap 多申请 2MB，裁掉首尾使起始地址按 2MB 对齐（内核只能用对齐的区间组成大页）
+//     2. madvise(MADV_HUGEPAGE) 提示内核用大页支撑该区间
+// 小于 huge_threshold 的请求仍走 operator new，避免小 vector 浪费整页。
+// 非 Linux 平台退化为 operator new。
+//
+// 无状态分配器：所有实例相等 (is_always_equal)，容器赋值/交换无需特殊处理。
+
+template <typename T>
+struct myHugePageAllocator {
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    static constexpr size_t huge_page_size = size_t(2) << 20;   // 2MB
+    static constexpr size_t huge_threshold = huge_page_size;    // 达到 1 个大页才使用 mmap
+
+    myHugePageAllocator() = default;
+    template <typename U> myHugePageAllocator(const myHugePageAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        size_t bytes = n * sizeof(T);
+#if defined(__linux__)
+        if (bytes >= huge_threshold) {
+            size_t length = round_up(bytes);
+            char* raw = static_cast<char*>(::mmap(nullptr, length + huge_page_size, PROT_READ | PROT_WRITE,
+                                                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+            if (raw == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            // 裁掉首尾多余部分，只保留按 2MB 对齐的 length 字节
+            std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(raw);
+            char* aligned = reinterpret_cast<char*>((addr + huge_page_size - 1) & ~(std::uintptr_t(huge_page_size) - 1));
+            size_t head = aligned - raw, tail = huge_page_size - head;
+            if (head > 0) ::munmap(raw, head);
+            if (tail > 0) ::munmap(aligned + length, tail);
+#if defined(MADV_HUGEPAGE)
+            ::madvise(aligned, length, MADV_HUGEPAGE); // 只是提示，失败（如 THP 关闭）时仍可用普通页
+#endif
+            return reinterpret_cast<T*>(aligned);
+        }
+#endif
+        return static_cast<T*>(::operator new(bytes));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (p == nullptr) {
+            return;
+        }
+#if defined(__linux__)
+        if (n * sizeof(T) >= huge_threshold) {
+            ::munmap(p, round_up(n * sizeof(T)));
+            return;
+        }
+#endif
+        (void)n;
+        ::operator delete(p);
+    }
+
+private:
+    static size_t round_up(size_t bytes) {
+        return (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const myHugePageAllocator<T>&, const myHugePageAllocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const myHugePageAllocator<T>&, const myHugePageAllocator<U>&) { return false; }
+
+#endif // MY_HUGE_PAGE_ALLOCATOR_H
@@ -0,0 +1,104 @@
+#ifndef MY_MALLOC_ALLOCATOR_H
+#define MY_MALLOC_ALLOCATOR_H
+
+#include <cstddef>      // size_t, std::max_align_t
+#include <cstdlib>      // std::malloc, std::realloc, std::free
+#include <cstring>      // std::memcpy
+#include <new>          // std::bad_alloc
+
+#if defined(__linux__)
+#include <sys/mman.h>   // mmap, mremap, munmap
+#endif
+
+// ==========================================================
+// myMallocAllocator：支持原地扩容的分配器
+// ==========================================================
+// std::allocator 的内存来自 operator new，无法交给 realloc 处理，
+// 因此扩容只能 "申请新块 -> 拷贝 -> 释放旧块"，峰值内存是新旧两块之和。
+//
+// 本分配器额外提供扩展接口：
+//     T* reallocate(T* p, size_t oldN, size_t newN);
+// myVector 检测到该接口且 T 可平凡重定位时，扩容直接调用它：
+//     - 小块：交给 std::realloc，尾部有空闲时原地扩展，否则由 libc 完成搬迁
+//     - 大块 (Linux)：直接 mmap 整页，扩容时 mremap 只修改页表，不拷贝数据
+// 失败时抛出 std::bad_alloc，且原内存块保持不变。
+
+template <typename T>
+struct myMallocAllocator {
+    using value_type = T;
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+
+    // 达到该字节数后改用 mmap / mremap
+    static constexpr size_t mmap_threshold = size_t(1) << 20; // 1MB
+
+    myMallocAllocator() = default;
+    template <typename U> myMallocAllocator(const myMallocAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        size_t bytes = n * sizeof(T);
+#if defined(__linux__)
+        if (bytes >= mmap_threshold) {
+            void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(p);
+        }
+#endif
+        void* p = std::malloc(bytes == 0 ? 1 : bytes);
+        if (p == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (p == nullptr) {
+            return;
+        }
+#if defined(__linux__)
+        if (n * sizeof(T) >= mmap_threshold) {
+            ::munmap(p, n * sizeof(T));
+            return;
+        }
+#endif
+        (void)n;
+        std::free(p);
+    }
+
+    // 扩展接口：把 [p, p + oldN) 扩展（或收缩）为 newN 个元素的内存块，按字节保留原内容
+    T* reallocate(T* p, size_t oldN, size_t newN) {
+        size_t oldBytes = oldN * sizeof(T), newBytes = newN * sizeof(T);
+#if defined(__linux__)
+        bool oldMapped = oldBytes >= mmap_threshold, newMapped = newBytes >= mmap_threshold;
+        if (oldMapped && newMapped) {
+            void* q = ::mremap(p, oldBytes, newBytes, MREMAP_MAYMOVE);
+            if (q == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(q);
+        }
+        if (oldMapped || newMapped) {
+            // 跨越阈值：只能分配新块并拷贝一次
+            T* q = allocate(newN);
+            std::memcpy(static_cast<void*>(q), static_cast<const void*>(p), oldBytes < newBytes ? oldBytes : newBytes);
+            deallocate(p, oldN);
+            return q;
+        }
+#else
+        (void)oldBytes;
+#endif
+        void* q = std::realloc(p, newBytes == 0 ? 1 : newBytes);
+        if (q == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(q);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const myMallocAllocator<T>&, const myMallocAllocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const myMallocAllocator<T>&, const myMallocAllocator<U>&) { return false; }
+
+#endif // MY_MALLOC_ALLOCATOR_H
@@ -0,0 +1,151 @@
+#ifndef MY_NODE_POOL_ALLOCATOR_H
+#define MY_NODE_POOL_ALLOCATOR_H
+
+#include <cstddef>      // size_t
+#include <new>          // ::operator new(size_t, std::align_val_t)
+#include <memory>       // std::shared_ptr
+#include <type_traits>  // std::true_type
+
+// ==========================================================
+// myNodePool + myNodePoolAllocator：节点容器专用的单尺寸 slab 池
+// ==========================================================
+// 链表 / 树这类节点式容器每次插入只申请 1 个固定大小的节点，
+// 逐个 operator new / delete 时吞吐被 malloc 限制，且相邻节点散落在堆上。
+// myNodePool 只服务一种尺寸（首次分配时确定）：
+//     - 按块 (block) 向系统申请内存，块起点按 cache line (64B) 对齐，块内节点紧密排列
+//     - deallocate 把节点头插回空闲链表，下一次 allocate 直接复用（LIFO，刚释放的节点仍在缓存中）
+//     - 块大小从 first_block 个节点开始按 2 倍增长，上限 max_block 个节点
+//     - 池析构时一次性归还所有块；池存活期间不会把内存还给系统
+// 其它尺寸的请求（如 n > 1）直接交给 operator new / delete。
+//
+// myNodePoolAllocator<T> 通过 shared_ptr 共享一个池：
+//     - 默认构造即创建一个新池，因此每个容器拥有自己的池（"per-list" 池），互不争用
+//     - rebind 得到的分配器与原分配器共享同一个池，二者相等
+//     - 拷贝构造 / 拷贝赋值时不共享对方的池（select_on_container_copy_construction 返回新池，
+//       拷贝赋值不传播），副本始终使用自己的池
+//     - 移动赋值 / 交换时随节点一起传播，节点始终由分配它的池回收
+// 非线程安全：一个池只应由一个容器（及其所在线程）使用。
+
+class myNodePool {
+private:
+    static constexpr size_t block_align = 64;
+    static constexpr size_t first_block = 32;
+    static constexpr size_t max_block = 4096;
+    struct FreeNode { FreeNode* next; };
+    struct Block { Block* next; size_t bytes; };
+
+    size_t    _slotSize;      // 0 表示尚未确定
+    size_t    _nextBlock;     // 下一块的节点数
+    FreeNode* _free;
+    Block*    _blocks;
+    char*     _cur;
+    char*     _end;
+    size_t    _blockCount;
+
+public:
+    myNodePool() : _slotSize(0), _nextBlock(first_block), _free(nullptr), _blocks(nullptr),
+                   _cur(nullptr), _end(nullptr), _blockCount(0) {}
+    ~myNodePool() {
+        while (_blocks != nullptr) {
+            Block* next = _blocks->next;
+            ::operator delete(_blocks, std::align_val_t(block_align));
+            _blocks = next;
+        }
+    }
+    myNodePool(const myNodePool&) = delete;
+    myNodePool& operator=(const myNodePool&) = delete;
+
+    void* allocate(size_t bytes, size_t align) {
+        if (_slotSize == 0 && bytes != 0) {
+            _slotSize = slot_for(bytes, align);
+        }
+        if (bytes == 0 || slot_for(bytes, align) != _slotSize) {
+            return ::operator new(bytes);
+        }
+        if (_free != nullptr) {
+            FreeNode* node = _free;
+            _free = node->next;
+            return node;
+        }
+        if (_cur == nullptr || _cur + _slotSize > _end) {
+            new_block();
+        }
+        void* p = _cur;
+        _cur += _slotSize;
+        return p;
+    }
+
+    void deallocate(void* p, size_t bytes, size_t align) noexcept {
+        if (p == nullptr) {
+            return;
+        }
+        if (bytes == 0 || slot_for(bytes, align) != _slotSize) {
+            ::operator delete(p);
+            return;
+        }
+        FreeNode* node = static_cast<FreeNode*>(p);
+        node->next = _free;
+        _free = node;
+    }
+
+    size_t slot_size() const noexcept { return _slotSize; }
+    size_t block_count() const noexcept { return _blockCount; }
+
+private:
+    // 空闲节点要在槽位里存放 next 指针：槽位至少一个指针大小，并按指针对齐
+    static size_t slot_for(size_t bytes, size_t align) noexcept {
+        if (bytes < sizeof(FreeNode)) bytes = sizeof(FreeNode);
+        if (align < alignof(FreeNode)) align = alignof(FreeNode);
+        return (bytes + align - 1) / align * align;
+    }
+
+    void new_block() {
+        // 块头单独占一条 cache line，节点从下一条 cache line 开始
+        size_t bytes = block_align + _nextBlock * _slotSize;
+        Block* b = static_cast<Block*>(::operator new(bytes, std::align_val_t(block_align)));
+        b->next = _blocks;
+        b->bytes = bytes;
+        _blocks = b;
+        _cur = reinterpret_cast<char*>(b) + block_align;
+        _end = reinterpret_cast<char*>(b) + bytes;
+        _blockCount ++;
+        if (_nextBlock < max_block) {
+            _nextBlock *= 2;
+        }
+    }
+};
+
+template <typename T>
+struct myNodePoolAllocator {
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    std::shared_ptr<myNodePool> pool;
+
+    myNodePoolAllocator() : pool(std::make_shared<myNodePool>()) {}
+    template <typename U> myNodePoolAllocator(const myNodePoolAllocator<U>& other) noexcept : pool(other.pool) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(pool->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        pool->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    // 容器拷贝构造时使用新池
+    myNodePoolAllocator select_on_container_copy_construction() const {
+        return myNodePoolAllocator();
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const myNodePoolAllocator<T>& a, const myNodePoolAllocator<U>& b) { return a.pool == b.pool; }
+template <typename T, typename U>
+bool operator!=(const myNodePoolAllocator<T>& a, const myNodePoolAllocator<U>& b) { return a.pool != b.pool; }
+
+#endif // MY_NODE_POOL_ALLOCATOR_H
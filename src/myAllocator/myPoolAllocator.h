@@ -0,0 +1,150 @@
+#ifndef MY_POOL_ALLOCATOR_H
+#define MY_POOL_ALLOCATOR_H
+
+#include <cstddef>      // size_t, std::max_align_t
+#include <cstdint>      // uintptr_t
+#include <new>          // ::operator new
+#include <type_traits>  // std::false_type
+
+// ==========================================================
+// myPool + myPoolAllocator：分级 (size-class) 内存池
+// ==========================================================
+// 把请求按 8, 16, 32, ..., 1024 字节分为 8 个等级，每个等级维护一条空闲链表：
+//     - allocate：空闲链表非空则弹出头结点，否则从当前 chunk 切一格
+//     - deallocate：把内存头插回对应等级的空闲链表，供下一次同等级请求复用
+// 超过 1024 字节的请求直接交给 operator new / delete。
+// 各等级共用 chunk：切分前把 _cur 上调到 min(格子大小, alignof(std::max_align_t)) 的整数倍，
+// 因此每一格都满足其大小所能容纳的任何（非超对齐）类型的对齐要求。
+//
+//  free_list[3] (64B) ─► [slot] ─► [slot] ─► nullptr
+//  chunk:  ┌────┬────┬────┬────┬──────────── ...
+//          │ 64 │ 32 │ 64 │ 16 │   未切分
+//          └────┴────┴────┴────┴──────────── ...
+//
+// myPoolAllocator<T> 持有 myPool* （非拥有），与 std::pmr::polymorphic_allocator 相同，
+// 分配器**不随赋值/交换传播**：容器始终从构造时指定的内存池取内存，
+// 两个来自不同内存池的 myVector 之间移动赋值会退化为逐元素移动。
+
+class myPool {
+private:
+    static constexpr size_t class_count = 8;
+    static constexpr size_t min_class = 8;
+    static constexpr size_t max_class = min_class << (class_count - 1); // 1024
+    static constexpr size_t max_align = alignof(std::max_align_t);
+    // chunk 头部占用的字节数：容纳 Chunk 且保持 max_align 对齐
+    static constexpr size_t header_size = (sizeof(void*) + max_align - 1) / max_align * max_align;
+    struct FreeNode { FreeNode* next; };
+    struct Chunk { Chunk* next; };
+
+    FreeNode* _free[class_count];
+    Chunk*    _chunks;
+    char*     _cur;
+    char*     _end;
+    size_t    _chunkSize;
+
+public:
+    explicit myPool(size_t chunkSize = 64 * 1024)
+        : _chunks(nullptr), _cur(nullptr), _end(nullptr), _chunkSize(chunkSize) {
+        for (size_t i = 0; i < class_count; i ++) {
+            _free[i] = nullptr;
+        }
+    }
+    ~myPool() {
+        while (_chunks != nullptr) {
+            Chunk* next = _chunks->next;
+            ::operator delete(_chunks);
+            _chunks = next;
+        }
+    }
+    myPool(const myPool&) = delete;
+    myPool& operator=(const myPool&) = delete;
+
+    void* allocate(size_t bytes) {
+        if (bytes > max_class) {
+            return ::operator new(bytes);
+        }
+        size_t idx = class_index(bytes);
+        if (_free[idx] != nullptr) {
+            FreeNode* node = _free[idx];
+            _free[idx] = node->next;
+            return node;
+        }
+        size_t slot = min_class << idx;
+        size_t align = slot < max_align ? slot : max_align;
+        char* p = (_cur == nullptr) ? nullptr : align_up(_cur, align);
+        if (p == nullptr || p + slot > _end) {
+            new_chunk();
+            p = _cur;
+        }
+        _cur = p + slot;
+        return p;
+    }
+
+    void deallocate(void* p, size_t bytes) noexcept {
+        if (p == nullptr) {
+            return;
+        }
+        if (bytes > max_class) {
+            ::operator delete(p);
+            return;
+        }
+        size_t idx = class_index(bytes);
+        FreeNode* node = static_cast<FreeNode*>(p);
+        node->next = _free[idx];
+        _free[idx] = node;
+    }
+
+private:
+    static size_t class_index(size_t bytes) {
+        size_t idx = 0, size = min_class;
+        while (size < bytes) {
+            size <<= 1;
+            idx ++;
+        }
+        return idx;
+    }
+
+    static char* align_up(char* p, size_t align) {
+        uintptr_t addr = reinterpret_cast<uintptr_t>(p);
+        return p + ((align - addr % align) % align);
+    }
+
+    void new_chunk() {
+        // 旧 chunk 尾部不足一格的零头直接放弃；operator new 返回 max_align 对齐的地址，头部之后仍然对齐
+        Chunk* c = static_cast<Chunk*>(::operator new(_chunkSize));
+        c->next = _chunks;
+        _chunks = c;
+        _cur = reinterpret_cast<char*>(c) + header_size;
+        _end = reinterpret_cast<char*>(c) + _chunkSize;
+    }
+};
+
+template <typename T>
+struct myPoolAllocator {
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    myPool* pool;
+
+    explicit myPoolAllocator(myPool& p) noexcept : pool(&p) {}
+    template <typename U> myPoolAllocator(const myPoolAllocator<U>& other) noexcept : pool(other.pool) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(pool->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        pool->deallocate(p, n * sizeof(T));
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const myPoolAllocator<T>& a, const myPoolAllocator<U>& b) { return a.pool == b.pool; }
+template <typename T, typename U>
+bool operator!=(const myPoolAllocator<T>& a, const myPoolAllocator<U>& b) { return a.pool != b.pool; }
+
+#endif // MY_POOL_ALLOCATOR_H
@@ -0,0 +1,362 @@
+#ifndef MY_FLAT_MAP_H
+#define MY_FLAT_MAP_H
+
+#include <cstddef>          // size_t
+#include <utility>          // std::pair, std::move, std::forward
+#include <functional>       // std::less
+#include <algorithm>        // std::stable_sort
+#include <stdexcept>        // std::out_of_range
+#include <type_traits>      // std::conditional_t, std::is_same_v
+#include <initializer_list>
+#include "../myVector/myVector.h"
+#include "myFlatSet.h"
+
+// ==========================================================
+// myFlatMap：基于有序 myVector 的映射
+// ==========================================================
+// 与 myFlatSet 相同的思路（有序数组 + 无分支二分 + 批量构造 + 归并式 insert_range），
+// 另外提供两种存储布局，由第 4 个模板参数选择：
+//
+//   myFlatInterleaved（默认）: [k0 v0][k1 v1][k2 v2] ...   一个 myVector<pair<K, V>>
+//   myFlatSplit              : [k0 k1 k2 ...] [v0 v1 v2 ...] 两个 myVector
+//
+// 查找只比较键。Value 较大时交错布局每条 cache line 只能放下少数几个键；
+// 分离布局下键数组是稠密的，二分与按键扫描的缓存利用率更高，代价是每次插入 / 删除
+// 要搬移两个数组。
+//
+// 迭代器按下标访问，解引用得到 std::pair<const Key&, Value&>，也可用 it.key() / it.value()。
+// 重复键的处理与 std::map 一致：insert 不覆盖已有值，批量构造保留每个键第一次出现的值。
+
+struct myFlatInterleaved {};
+struct myFlatSplit {};
+
+namespace myFlatDetail {
+
+// 交错布局
+template <typename Key, typename Value>
+struct InterleavedStorage {
+    myVector<std::pair<Key, Value>> items;
+
+    size_t size() const noexcept { return items.size(); }
+    const Key& key(size_t i) const { return items[i].first; }
+    Value& value(size_t i) { return items[i].second; }
+    const Value& value(size_t i) const { return items[i].second; }
+    void reserve(size_t n) { items.reserve(n); }
+    void clear() { items.clear(); }
+    void swap(InterleavedStorage& other) noexcept { items.swap(other.items); }
+    void erase(size_t i) { items.erase(items.begin() + i); }
+
+    template <typename Compare>
+    size_t lower_bound(const Key& k, const Compare& comp) const {
+        auto keyOf = [](const std::pair<Key, Value>& item) -> const Key& { return item.first; };
+        return static_cast<size_t>(branchless_lower_bound(items.begin(), items.size(), k, keyOf, comp) - items.begin());
+    }
+    template <typename K, typename V>
+    void insert(size_t i, K&& k, V&& v) {
+        items.insert(items.begin() + i, std::pair<Key, Value>(std::forward<K>(k), std::forward<V>(v)));
+    }
+    template <typename K, typename V>
+    void push_back(K&& k, V&& v) {
+        items.push_back(std::pair<Key, Value>(std::forward<K>(k), std::forward<V>(v)));
+    }
+};
+
+// 分离布局：两列长度始终相同
+template <typename Key, typename Value>
+struct SplitStorage {
+    myVector<Key> keys;
+    myVector<Value> values;
+
+    size_t size() const noexcept { return keys.size(); }
+    const Key& key(size_t i) const { return keys[i]; }
+    Value& value(size_t i) { return values[i]; }
+    const Value& value(size_t i) const { return values[i]; }
+    void reserve(size_t n) { keys.reserve(n); values.reserve(n); }
+    void clear() { keys.clear(); values.clear(); }
+    void swap(SplitStorage& other) noexcept { keys.swap(other.keys); values.swap(other.values); }
+    void erase(size_t i) { keys.erase(keys.begin() + i); values.erase(values.begin() + i); }
+
+    template <typename Compare>
+    size_t lower_bound(const Key& k, const Compare& comp) const {
+        return static_cast<size_t>(branchless_lower_bound(keys.begin(), keys.size(), k, Identity(), comp) - keys.begin());
+    }
+    template <typename K, typename V>
+    void insert(size_t i, K&& k, V&& v) {
+        keys.insert(keys.begin() + i, std::forward<K>(k));
+        try {
+            values.insert(values.begin() + i, std::forward<V>(v));
+        } catch (...) {
+            keys.erase(keys.begin() + i);   // 回滚，保持两列一致
+            throw;
+        }
+    }
+    template <typename K, typename V>
+    void push_back(K&& k, V&& v) {
+        keys.push_back(std::forward<K>(k));
+        try {
+            values.push_back(std::forward<V>(v));
+        } catch (...) {
+            keys.pop_back();
+            throw;
+        }
+    }
+};
+
+} // namespace myFlatDetail
+
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Layout = myFlatInterleaved>
+class myFlatMap {
+    static_assert(std::is_same_v<Layout, myFlatInterleaved> || std::is_same_v<Layout, myFlatSplit>,
+                  "Layout must be myFlatInterleaved or myFlatSplit");
+private:
+    using storage_type = std::conditional_t<std::is_same_v<Layout, myFlatSplit>,
+                                            myFlatDetail::SplitStorage<Key, Value>,
+                                            myFlatDetail::InterleavedStorage<Key, Value>>;
+    storage_type _storage;
+    Compare _comp;
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+
+    /* ===== 迭代器 ===== */
+    template <bool Const>
+    class basic_iterator {
+    public:
+        using owner_type = std::conditional_t<Const, const myFlatMap*, myFlatMap*>;
+        using value_ref = std::conditional_t<Const, const Value&, Value&>;
+        using reference = std::pair<const Key&, value_ref>;
+
+        // operator-> 需要返回指针，这里用一个持有 pair 的小代理
+        struct arrow_proxy {
+            reference ref;
+            const reference* operator->() const noexcept { return &ref; }
+        };
+
+        basic_iterator(owner_type owner, size_t index) : _owner(owner), _index(index) {}
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& other) : _owner(other._owner), _index(other._index) {}
+
+        const Key& key() const { return _owner->_storage.key(_index); }
+        value_ref value() const { return _owner->_storage.value(_index); }
+        reference operator*() const { return reference(key(), value()); }
+        arrow_proxy operator->() const { return arrow_proxy{ **this }; }
+        basic_iterator& operator++() { ++ _index; return *this; }
+        basic_iterator operator++(int) { basic_iterator temp = *this; ++ _index; return temp; }
+        basic_iterator& operator--() { -- _index; return *this; }
+        basic_iterator operator--(int) { basic_iterator temp = *this; -- _index; return temp; }
+        bool operator==(const basic_iterator& other) const { return _index == other._index; }
+        bool operator!=(const basic_iterator& other) const { return _index != other._index; }
+        size_t index() const noexcept { return _index; }
+
+    private:
+        friend class myFlatMap;
+        template <bool> friend class basic_iterator;
+        owner_type _owner;
+        size_t _index;
+    };
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /* ===== 构造 ===== */
+    myFlatMap() = default;
+    explicit myFlatMap(const Compare& comp) : _comp(comp) {}
+    template <typename InputIt, typename = myVector_require_input_iter<InputIt>>
+    myFlatMap(InputIt first, InputIt last, const Compare& comp = Compare());
+    myFlatMap(std::initializer_list<std::pair<Key, Value>> ilist, const Compare& comp = Compare())
+        : myFlatMap(ilist.begin(), ilist.end(), comp) {}
+
+    /* ===== 容量相关 ===== */
+    size_t size() const noexcept { return _storage.size(); }
+    bool empty() const noexcept { return _storage.size() == 0; }
+    void reserve(size_t n) { _storage.reserve(n); }
+    void clear() { _storage.clear(); }
+
+    /* ===== 迭代器 ===== */
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size()); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size()); }
+
+    /* ===== 元素访问 ===== */
+    Value& operator[](const Key& key);
+    Value& at(const Key& key);
+    const Value& at(const Key& key) const;
+    // 仅分离布局：连续的键数组，可直接交给扫描 / SIMD 代码
+    template <typename L = Layout, typename = std::enable_if_t<std::is_same_v<L, myFlatSplit>>>
+    const Key* key_data() const noexcept { return _storage.keys.begin(); }
+
+    /* ===== 查找 ===== */
+    iterator lower_bound(const Key& key) { return iterator(this, _storage.lower_bound(key, _comp)); }
+    const_iterator lower_bound(const Key& key) const { return const_iterator(this, _storage.lower_bound(key, _comp)); }
+    iterator find(const Key& key) { return iterator(this, find_index(key)); }
+    const_iterator find(const Key& key) const { return const_iterator(this, find_index(key)); }
+    bool contains(const Key& key) const { return find_index(key) != size(); }
+    size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    /* ===== 修改器 ===== */
+    template <typename V>
+    std::pair<iterator, bool> insert(const Key& key, V&& value);
+    template <typename V>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, V&& value);
+    template <typename InputIt, typename = myVector_require_input_iter<InputIt>>
+    void insert_range(InputIt first, InputIt last);
+    size_t erase(const Key& key);
+
+private:
+    /* ===== 内部工具 ===== */
+    size_t find_index(const Key& key) const;
+    template <typename InputIt>
+    myVector<std::pair<Key, Value>> sorted_unique(InputIt first, InputIt last) const;
+};
+
+
+// ==========================================================
+// Implementation - Constructors
+// ==========================================================
+
+template <typename Key, typename Value, typename Compare, typename Layout>
+template <typename InputIt, typename>
+myFlatMap<Key, Value, Compare, Layout>::myFlatMap(InputIt first, InputIt last, const Compare& comp) : _comp(comp) {
+    myVector<std::pair<Key, Value>> items = sorted_unique(first, last);
+    _storage.reserve(items.size());
+    for (size_t i = 0; i < items.size(); ++ i) {
+        _storage.push_back(std::move(items[i].first), std::move(items[i].second));
+    }
+}
+
+// ==========================================================
+// Implementation - Access
+// ==========================================================
+
+template <typename Key, typename Value, typename Compare, typename Layout>
+Value& myFlatMap<Key, Value, Compare, Layout>::operator[](const Key& key) {
+    size_t i = _storage.lower_bound(key, _comp);
+    if (i == size() || _comp(key, _storage.key(i))) {
+        _storage.insert(i, key, Value());
+    }
+    return _storage.value(i);
+}
+
+template <typename Key, typename Value, typename Compare, typename Layout>
+Value& myFlatMap<Key, Value, Compare, Layout>::at(const Key& key) {
+    size_t i = find_index(key);
+    if (i == size()) {
+        throw std::out_of_range("Key not found");
+    }
+    return _storage.value(i);
+}
+
+template <typename Key, typename Value, typename Compare, typename Layout>
+const Value& myFlatMap<Key, Value, Compare, Layout>::at(const Key& key) const {
+    size_t i = find_index(key);
+    if (i == size()) {
+        throw std::out_of_range("Key not found");
+    }
+    return _storage.value(i);
+}
+
+// ==========================================================
+// Implementation - Modifiers
+// ==========================================================
+
+template <typename Key, typename Value, typename Compare, typename Layout>
+template <typename V>
+std::pair<typename myFlatMap<Key, Value, Compare, Layout>::iterator, bool>
+myFlatMap<Key, Value, Compare, Layout>::insert(const Key& key, V&& value) {
+    size_t i = _storage.lower_bound(key, _comp);
+    if (i < size() && !_comp(key, _storage.key(i))) {
+        return { iterator(this, i), false };
+    }
+    _storage.insert(i, key, std::forward<V>(value));
+    return { iterator(this, i), true };
+}
+
+template <typename Key, typename Value, typename Compare, typename Layout>
+template <typename V>
+std::pair<typename myFlatMap<Key, Value, Compare, Layout>::iterator, bool>
+myFlatMap<Key, Value, Compare, Layout>::insert_or_assign(const Key& key, V&& value) {
+    size_t i = _storage.lower_bound(key, _comp);
+    if (i < size() && !_comp(key, _storage.key(i))) {
+        _storage.value(i) = std::forward<V>(value);
+        return { iterator(this, i), false };
+    }
+    _storage.insert(i, key, std::forward<V>(value));
+    return { iterator(this, i), true };
+}
+
+// 新元素排序去重后与原数据线性归并到新存储；中途抛异常时原映射不变（强保证）
+template <typename Key, typename Value, typename Compare, typename Layout>
+template <typename InputIt, typename>
+void myFlatMap<Key, Value, Compare, Layout>::insert_range(InputIt first, InputIt last) {
+    myVector<std::pair<Key, Value>> incoming = sorted_unique(first, last);
+    if (incoming.empty()) {
+        return;
+    }
+    storage_type merged;
+    merged.reserve(size() + incoming.size());
+    size_t i = 0, j = 0, n = size();
+    while (i < n && j < incoming.size()) {
+        if (_comp(_storage.key(i), incoming[j].first)) {
+            merged.push_back(_storage.key(i), _storage.value(i));
+            i ++;
+        } else if (_comp(incoming[j].first, _storage.key(i))) {
+            merged.push_back(std::move(incoming[j].first), std::move(incoming[j].second));
+            j ++;
+        } else {
+            merged.push_back(_storage.key(i), _storage.value(i));   // 已存在：保留原值
+            i ++;
+            j ++;
+        }
+    }
+    for (; i < n; ++ i) merged.push_back(_storage.key(i), _storage.value(i));
+    for (; j < incoming.size(); ++ j) merged.push_back(std::move(incoming[j].first), std::move(incoming[j].second));
+    _storage.swap(merged);
+}
+
+template <typename Key, typename Value, typename Compare, typename Layout>
+size_t myFlatMap<Key, Value, Compare, Layout>::erase(const Key& key) {
+    size_t i = find_index(key);
+    if (i == size()) {
+        return 0;
+    }
+    _storage.erase(i);
+    return 1;
+}
+
+// ==========================================================
+// Implementation - Internal Tools
+// ==========================================================
+
+template <typename Key, typename Value, typename Compare, typename Layout>
+size_t myFlatMap<Key, Value, Compare, Layout>::find_index(const Key& key) const {
+    size_t i = _storage.lower_bound(key, _comp);
+    return (i < size() && !_comp(key, _storage.key(i))) ? i : size();
+}
+
+// 稳定排序后去重，每个键保留第一次出现的值
+template <typename Key, typename Value, typename Compare, typename Layout>
+template <typename InputIt>
+myVector<std::pair<Key, Value>> myFlatMap<Key, Value, Compare, Layout>::sorted_unique(InputIt first, InputIt last) const {
+    myVector<std::pair<Key, Value>> items;
+    items.assign(first, last);
+    const Compare& comp = _comp;
+    std::stable_sort(items.begin(), items.end(), [&comp](const std::pair<Key, Value>& a, const std::pair<Key, Value>& b) {
+        return comp(a.first, b.first);
+    });
+    size_t out = 0;
+    for (size_t i = 0; i < items.size(); ++ i) {
+        if (out == 0 || comp(items[out - 1].first, items[i].first)) {
+            if (out != i) {
+                items[out] = std::move(items[i]);
+            }
+            out ++;
+        }
+    }
+    while (items.size() > out) {
+        items.pop_back();
+    }
+    return items;
+}
+
+#endif // MY_FLAT_MAP_H
@@ -0,0 +1,245 @@
+#ifndef MY_FLAT_SET_H
+#define MY_FLAT_SET_H
+
+#include <cstddef>          // size_t
+#include <utility>          // std::pair, std::move
+#include <functional>       // std::less
+#include <algorithm>        // std::stable_sort
+#include <initializer_list>
+#include <iterator>         // std::distance
+#include "../myVector/myVector.h"
+
+// ==========================================================
+// myFlatSet：基于有序 myVector 的集合
+// ==========================================================
+// 红黑树每个节点单独分配，查找时每下降一层就是一次 cache miss；
+// 有序连续数组上的二分查找只访问 log2(N) 个位置，且前几层的位置对所有查找都相同，
+// 常驻缓存。代价是插入 / 删除需要搬移后半段元素，因此适合 "读多写少" 的查找表。
+//
+//     - 查找：无分支二分 (branchless_lower_bound)，循环体编译为条件传送，没有分支预测失败
+//     - 批量构造：一次追加、一次排序、一次去重，O(N log N)
+//     - insert_range：新元素先排序去重，再与原数组做一次线性归并，O(N + M log M)，
+//       而不是 M 次 O(N) 的中间插入
+//
+// 迭代器为 const Key*：修改元素会破坏有序性，只提供只读访问。
+
+namespace myFlatDetail {
+
+// 无分支 lower_bound：每轮把区间折半，用条件传送代替 if 跳转
+template <typename T, typename K, typename KeyOf, typename Compare>
+const T* branchless_lower_bound(const T* first, size_t n, const K& key, KeyOf keyOf, const Compare& comp) {
+    if (n == 0) {
+        return first;
+    }
+    const T* base = first;
+    while (n > 1) {
+        size_t half = n / 2;
+        base = comp(keyOf(base[half]), key) ? base + half : base;
+        n -= half;
+    }
+    return base + (comp(keyOf(*base), key) ? 1 : 0);
+}
+
+struct Identity {
+    template <typename T>
+    const T& operator()(const T& value) const noexcept { return value; }
+};
+
+} // namespace myFlatDetail
+
+template <typename Key, typename Compare = std::less<Key>>
+class myFlatSet {
+private:
+    myVector<Key> _keys;    // 严格递增
+    Compare _comp;
+
+public:
+    using value_type = Key;
+    using iterator = const Key*;
+    using const_iterator = const Key*;
+
+    /* ===== 构造 ===== */
+    myFlatSet() = default;
+    explicit myFlatSet(const Compare& comp) : _comp(comp) {}
+    template <typename InputIt, typename = myVector_require_input_iter<InputIt>>
+    myFlatSet(InputIt first, InputIt last, const Compare& comp = Compare());
+    myFlatSet(std::initializer_list<Key> ilist, const Compare& comp = Compare())
+        : myFlatSet(ilist.begin(), ilist.end(), comp) {}
+
+    /* ===== 容量相关 ===== */
+    size_t size() const noexcept { return _keys.size(); }
+    bool empty() const noexcept { return _keys.empty(); }
+    size_t capacity() const noexcept { return _keys.capacity(); }
+    void reserve(size_t n) { _keys.reserve(n); }
+    void clear() { _keys.clear(); }
+
+    /* ===== 迭代器 ===== */
+    const_iterator begin() const noexcept { return _keys.begin(); }
+    const_iterator end() const noexcept { return _keys.end(); }
+    const Key* data() const noexcept { return _keys.begin(); }
+    const Key& operator[](size_t index) const { return _keys[index]; }
+
+    /* ===== 查找 ===== */
+    const_iterator lower_bound(const Key& key) const;
+    const_iterator upper_bound(const Key& key) const;
+    const_iterator find(const Key& key) const;
+    bool contains(const Key& key) const { return find(key) != end(); }
+    size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    /* ===== 修改器 ===== */
+    std::pair<iterator, bool> insert(const Key& key);
+    std::pair<iterator, bool> insert(Key&& key);
+    template <typename InputIt, typename = myVector_require_input_iter<InputIt>>
+    void insert_range(InputIt first, InputIt last);
+    void insert_range(std::initializer_list<Key> ilist) { insert_range(ilist.begin(), ilist.end()); }
+    size_t erase(const Key& key);
+    iterator erase(const_iterator pos);
+
+    bool operator==(const myFlatSet& other) const;
+    bool operator!=(const myFlatSet& other) const { return !(*this == other); }
+
+private:
+    /* ===== 内部工具 ===== */
+    bool equivalent(const Key& a, const Key& b) const { return !_comp(a, b) && !_comp(b, a); }
+    void sort_unique(myVector<Key>& keys) const;
+    template <typename K>
+    std::pair<iterator, bool> insert_one(K&& key);
+};
+
+
+// ==========================================================
+// Implementation - Constructors
+// ==========================================================
+
+template <typename Key, typename Compare>
+template <typename InputIt, typename>
+myFlatSet<Key, Compare>::myFlatSet(InputIt first, InputIt last, const Compare& comp) : _comp(comp) {
+    _keys.assign(first, last);
+    sort_unique(_keys);
+}
+
+// ==========================================================
+// Implementation - Lookup
+// ==========================================================
+
+template <typename Key, typename Compare>
+typename myFlatSet<Key, Compare>::const_iterator myFlatSet<Key, Compare>::lower_bound(const Key& key) const {
+    return myFlatDetail::branchless_lower_bound(_keys.begin(), _keys.size(), key, myFlatDetail::Identity(), _comp);
+}
+
+template <typename Key, typename Compare>
+typename myFlatSet<Key, Compare>::const_iterator myFlatSet<Key, Compare>::upper_bound(const Key& key) const {
+    const_iterator it = lower_bound(key);
+    return (it != end() && !_comp(key, *it)) ? it + 1 : it;
+}
+
+template <typename Key, typename Compare>
+typename myFlatSet<Key, Compare>::const_iterator myFlatSet<Key, Compare>::find(const Key& key) const {
+    const_iterator it = lower_bound(key);
+    return (it != end() && !_comp(key, *it)) ? it : end();
+}
+
+// ==========================================================
+// Implementation - Modifiers
+// ==========================================================
+
+template <typename Key, typename Compare>
+std::pair<typename myFlatSet<Key, Compare>::iterator, bool> myFlatSet<Key, Compare>::insert(const Key& key) {
+    return insert_one(key);
+}
+
+template <typename Key, typename Compare>
+std::pair<typename myFlatSet<Key, Compare>::iterator, bool> myFlatSet<Key, Compare>::insert(Key&& key) {
+    return insert_one(std::move(key));
+}
+
+template <typename Key, typename Compare>
+template <typename K>
+std::pair<typename myFlatSet<Key, Compare>::iterator, bool> myFlatSet<Key, Compare>::insert_one(K&& key) {
+    const_iterator pos = lower_bound(key);
+    if (pos != end() && !_comp(key, *pos)) {
+        return { pos, false };
+    }
+    return { _keys.insert(pos, std::forward<K>(key)), true };
+}
+
+// 新元素排序去重后与原数组线性归并到新缓冲区；中途抛异常时原集合不变（强保证）
+template <typename Key, typename Compare>
+template <typename InputIt, typename>
+void myFlatSet<Key, Compare>::insert_range(InputIt first, InputIt last) {
+    myVector<Key> incoming;
+    incoming.assign(first, last);
+    if (incoming.empty()) {
+        return;
+    }
+    sort_unique(incoming);
+
+    myVector<Key> merged;
+    merged.reserve(_keys.size() + incoming.size());
+    size_t i = 0, j = 0;
+    while (i < _keys.size() && j < incoming.size()) {
+        if (_comp(_keys[i], incoming[j])) {
+            merged.push_back(_keys[i ++]);
+        } else if (_comp(incoming[j], _keys[i])) {
+            merged.push_back(std::move(incoming[j ++]));
+        } else {
+            merged.push_back(_keys[i ++]);      // 已存在：保留原元素
+            j ++;
+        }
+    }
+    while (i < _keys.size()) merged.push_back(_keys[i ++]);
+    while (j < incoming.size()) merged.push_back(std::move(incoming[j ++]));
+    _keys.swap(merged);
+}
+
+template <typename Key, typename Compare>
+size_t myFlatSet<Key, Compare>::erase(const Key& key) {
+    const_iterator it = find(key);
+    if (it == end()) {
+        return 0;
+    }
+    _keys.erase(it);
+    return 1;
+}
+
+template <typename Key, typename Compare>
+typename myFlatSet<Key, Compare>::iterator myFlatSet<Key, Compare>::erase(const_iterator pos) {
+    return _keys.erase(pos);
+}
+
+template <typename Key, typename Compare>
+bool myFlatSet<Key, Compare>::operator==(const myFlatSet& other) const {
+    if (size() != other.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < size(); ++ i) {
+        if (!equivalent(_keys[i], other._keys[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ==========================================================
+// Implementation - Internal Tools
+// ==========================================================
+
+// 稳定排序后删除等价元素，每组保留输入中第一次出现的元素（与 myFlatMap::sorted_unique 一致）
+template <typename Key, typename Compare>
+void myFlatSet<Key, Compare>::sort_unique(myVector<Key>& keys) const {
+    std::stable_sort(keys.begin(), keys.end(), _comp);
+    size_t out = 0;
+    for (size_t i = 0; i < keys.size(); ++ i) {
+        if (out == 0 || _comp(keys[out - 1], keys[i])) {
+            if (out != i) {
+                keys[out] = std::move(keys[i]);
+            }
+            out ++;
+        }
+    }
+    while (keys.size() > out) {
+        keys.pop_back();
+    }
+}
+
+#endif // MY_FLAT_SET_H
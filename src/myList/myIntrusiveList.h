@@ -0,0 +1,339 @@
+#ifndef MY_INTRUSIVE_LIST_H
+#define MY_INTRUSIVE_LIST_H
+
+#include <cstddef>      // size_t, ptrdiff_t
+#include <exception>    // std::terminate
+#include <stdexcept>    // std::logic_error
+#include <iterator>     // std::bidirectional_iterator_tag
+#include <type_traits>  // std::conditional_t
+#include <utility>      // std::declval, std::swap
+
+// ==========================================================
+// myIntrusiveList：侵入式双向链表，零分配
+// ==========================================================
+// myList 把每个元素拷贝进一个新分配的 ListNode；对象本身已经有归属（arena、对象池、栈上）时，
+// 这次拷贝和分配都是多余的。侵入式链表把 prev / next（"钩子"）直接放在用户对象里：
+//
+//  struct Task {
+//      int id;
+//      myListHook<> runHook;       // 就绪队列
+//      myListHook<> allHook;       // 全部任务；一个对象可以同时挂在多条链表上
+//  };
+//  myIntrusiveList<Task, &Task::runHook> runQueue;
+//
+// 结构沿用 myList 的带哨兵双向环，哨兵内嵌在链表对象中：
+//     - 插入 / 删除只改指针，不分配、不拷贝；链表不拥有对象，对象的生命周期由使用者管理
+//     - 给定对象即可 O(1) 定位迭代器（iterator_to）并从链表中摘下
+//     - 钩子到对象的换算：对象地址 = 钩子地址 - 钩子在 T 中的偏移
+//
+// 钩子的三种模式（myLinkMode）：
+//     - normal      ：不做任何检查，摘下后不清空指针，开销最小
+//     - safe        ：未链接时指针为空；插入已链接的对象、摘下未链接的对象抛 std::logic_error，
+//                     仍在链表中的对象被析构时调用 std::terminate（避免留下悬空指针）
+//     - auto_unlink ：同 safe，但对象析构时自动从所在链表摘下；也可以直接调用 hook.unlink()，
+//                     不需要知道对象在哪条链表上。链表因此无法维护计数，size() 为 O(n)
+
+enum class myLinkMode { normal, safe, auto_unlink };
+
+struct myListHookBase {
+    myListHookBase* prev;
+    myListHookBase* next;
+};
+
+template <myLinkMode Mode = myLinkMode::safe>
+class myListHook : private myListHookBase {
+public:
+    static constexpr myLinkMode mode = Mode;
+
+    myListHook() noexcept : myListHookBase{nullptr, nullptr} {}
+    // 拷贝对象不拷贝其链表成员关系
+    myListHook(const myListHook&) noexcept : myListHookBase{nullptr, nullptr} {}
+    myListHook& operator=(const myListHook&) noexcept { return *this; }
+    ~myListHook() {
+        if constexpr (Mode == myLinkMode::safe) {
+            if (is_linked()) std::terminate();
+        } else if constexpr (Mode == myLinkMode::auto_unlink) {
+            unlink();
+        }
+    }
+
+    // normal 模式摘下后不清空指针，is_linked 只在插入前（默认构造后）可靠
+    bool is_linked() const noexcept { return next != nullptr; }
+
+    // 只有 auto_unlink 钩子可以脱离链表自行摘下（其余模式的链表维护着计数）
+    template <myLinkMode M = Mode, typename = std::enable_if_t<M == myLinkMode::auto_unlink>>
+    void unlink() noexcept {
+        if (next != nullptr) {
+            prev->next = next;
+            next->prev = prev;
+            prev = next = nullptr;
+        }
+    }
+
+private:
+    template <typename, auto> friend class myIntrusiveList;
+};
+
+template <typename T, auto HookPtr>
+class myIntrusiveList {
+public:
+    using hook_type = std::remove_reference_t<decltype(std::declval<T&>().*HookPtr)>;
+    static constexpr myLinkMode mode = hook_type::mode;
+    static constexpr bool constant_time_size = mode != myLinkMode::auto_unlink;
+
+private:
+    myListHookBase _head;       // 哨兵：_head.next 为首元素的钩子，_head.prev 为尾元素的钩子
+    size_t         _size;       // auto_unlink 模式下不使用
+
+    static myListHookBase* hook_of(T& value) noexcept { return &static_cast<myListHookBase&>(value.*HookPtr); }
+    static T* owner_of(myListHookBase* hook) noexcept {
+        return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(static_cast<hook_type*>(hook)) - hook_offset());
+    }
+    static std::ptrdiff_t hook_offset() noexcept {
+        // 成员指针没有标准的 offsetof 写法：借一块与 T 同尺寸、同对齐的静态内存做地址运算（不访问对象）
+        alignas(T) static unsigned char probe[sizeof(T)];
+        T* p = reinterpret_cast<T*>(probe);
+        return reinterpret_cast<unsigned char*>(&(p->*HookPtr)) - probe;
+    }
+
+public:
+    /* ===== 迭代器 ===== */
+    template <bool Const>
+    class basic_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() : _hook(nullptr) {}
+        explicit basic_iterator(myListHookBase* hook) : _hook(hook) {}
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& other) : _hook(other._hook) {}
+
+        reference operator*() const { return *owner_of(_hook); }
+        pointer operator->() const { return owner_of(_hook); }
+        basic_iterator& operator++() { _hook = _hook->next; return *this; }
+        basic_iterator operator++(int) { basic_iterator temp = *this; _hook = _hook->next; return temp; }
+        basic_iterator& operator--() { _hook = _hook->prev; return *this; }
+        basic_iterator operator--(int) { basic_iterator temp = *this; _hook = _hook->prev; return temp; }
+        bool operator==(const basic_iterator& other) const { return _hook == other._hook; }
+        bool operator!=(const basic_iterator& other) const { return _hook != other._hook; }
+
+    private:
+        friend class myIntrusiveList;
+        template <bool> friend class basic_iterator;
+        myListHookBase* _hook;
+    };
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /* ===== 构造 / 析构 ===== */
+    myIntrusiveList() noexcept;
+    ~myIntrusiveList();
+    // 对象只能属于一条链表（每个钩子）：不可拷贝，可移动
+    myIntrusiveList(const myIntrusiveList&) = delete;
+    myIntrusiveList& operator=(const myIntrusiveList&) = delete;
+    myIntrusiveList(myIntrusiveList&& other) noexcept;
+    myIntrusiveList& operator=(myIntrusiveList&& other) noexcept;
+    void swap(myIntrusiveList& other) noexcept;
+
+    /* ===== 修改器 ===== */
+    void push_front(T& value) { insert(begin(), value); }
+    void push_back(T& value) { insert(end(), value); }
+    void pop_front();
+    void pop_back();
+    iterator insert(const_iterator position, T& value);
+    // safe / auto_unlink 模式下摘下未链接的对象抛 std::logic_error；normal 模式不检查
+    iterator erase(const_iterator position) noexcept(mode == myLinkMode::normal);
+    void remove(T& value) noexcept(mode == myLinkMode::normal) { erase(iterator_to(value)); }   // O(1)：value 必须在本链表中
+    void clear() noexcept;
+    void splice(const_iterator position, myIntrusiveList& other) noexcept;
+
+    /* ===== 查询 ===== */
+    size_t size() const noexcept;
+    bool empty() const noexcept { return _head.next == &_head; }
+    T& front() { return *owner_of(_head.next); }
+    const T& front() const { return *owner_of(_head.next); }
+    T& back() { return *owner_of(_head.prev); }
+    const T& back() const { return *owner_of(_head.prev); }
+
+    /* ===== 迭代器 ===== */
+    iterator begin() noexcept { return iterator(_head.next); }
+    iterator end() noexcept { return iterator(&_head); }
+    const_iterator begin() const noexcept { return const_iterator(_head.next); }
+    const_iterator end() const noexcept { return const_iterator(const_cast<myListHookBase*>(&_head)); }
+    // 由对象直接得到迭代器：O(1)
+    iterator iterator_to(T& value) noexcept { return iterator(hook_of(value)); }
+    const_iterator iterator_to(const T& value) const noexcept { return const_iterator(hook_of(const_cast<T&>(value))); }
+
+private:
+    /* ===== 内部工具 ===== */
+    static void unlink_hook(myListHookBase* hook) noexcept;
+    static void relink(myListHookBase& to, myListHookBase& from) noexcept;    // 把 from 哨兵上的环转挂到 to 上
+};
+
+
+// ==========================================================
+// Implementation - Constructors / Destructor
+// ==========================================================
+
+template <typename T, auto HookPtr>
+myIntrusiveList<T, HookPtr>::myIntrusiveList() noexcept : _head{&_head, &_head}, _size(0) {}
+
+template <typename T, auto HookPtr>
+myIntrusiveList<T, HookPtr>::~myIntrusiveList() {
+    clear();
+}
+
+template <typename T, auto HookPtr>
+myIntrusiveList<T, HookPtr>::myIntrusiveList(myIntrusiveList&& other) noexcept : _head{&_head, &_head}, _size(other._size) {
+    relink(_head, other._head);
+    other._size = 0;
+}
+
+template <typename T, auto HookPtr>
+myIntrusiveList<T, HookPtr>& myIntrusiveList<T, HookPtr>::operator=(myIntrusiveList&& other) noexcept {
+    if (this != &other) {
+        clear();
+        relink(_head, other._head);
+        _size = other._size;
+        other._size = 0;
+    }
+    return *this;
+}
+
+template <typename T, auto HookPtr>
+void myIntrusiveList<T, HookPtr>::swap(myIntrusiveList& other) noexcept {
+    // 哨兵内嵌在对象中：首尾元素的钩子要改为指向对方的哨兵
+    myListHookBase temp{&temp, &temp};
+    relink(temp, _head);
+    relink(_head, other._head);
+    relink(other._head, temp);
+    std::swap(_size, other._size);
+}
+
+
+// ==========================================================
+// Implementation - Modifiers
+// ==========================================================
+
+template <typename T, auto HookPtr>
+typename myIntrusiveList<T, HookPtr>::iterator
+myIntrusiveList<T, HookPtr>::insert(const_iterator position, T& value) {
+    myListHookBase* hook = hook_of(value);
+    if constexpr (mode != myLinkMode::normal) {
+        if (hook->next != nullptr) {
+            throw std::logic_error("myIntrusiveList::insert: object is already linked");
+        }
+    }
+    myListHookBase* pos = position._hook;
+    hook->prev = pos->prev;
+    hook->next = pos;
+    pos->prev->next = hook;
+    pos->prev = hook;
+    ++ _size;
+    return iterator(hook);
+}
+
+template <typename T, auto HookPtr>
+typename myIntrusiveList<T, HookPtr>::iterator
+myIntrusiveList<T, HookPtr>::erase(const_iterator position) noexcept(mode == myLinkMode::normal) {
+    myListHookBase* hook = position._hook;
+    if (hook == &_head) return end();
+    if constexpr (mode != myLinkMode::normal) {
+        if (hook->next == nullptr) {
+            throw std::logic_error("myIntrusiveList::erase: object is not linked");
+        }
+    }
+    myListHookBase* next = hook->next;
+    unlink_hook(hook);
+    -- _size;
+    return iterator(next);
+}
+
+template <typename T, auto HookPtr>
+void myIntrusiveList<T, HookPtr>::pop_front() {
+    if (!empty()) {
+        erase(begin());
+    }
+}
+
+template <typename T, auto HookPtr>
+void myIntrusiveList<T, HookPtr>::pop_back() {
+    if (!empty()) {
+        erase(iterator(_head.prev));
+    }
+}
+
+template <typename T, auto HookPtr>
+void myIntrusiveList<T, HookPtr>::clear() noexcept {
+    // 只摘下对象，不析构；safe / auto_unlink 模式需要逐个清空钩子
+    if constexpr (mode != myLinkMode::normal) {
+        myListHookBase* hook = _head.next;
+        while (hook != &_head) {
+            myListHookBase* next = hook->next;
+            hook->prev = hook->next = nullptr;
+            hook = next;
+        }
+    }
+    _head.prev = _head.next = &_head;
+    _size = 0;
+}
+
+template <typename T, auto HookPtr>
+void myIntrusiveList<T, HookPtr>::splice(const_iterator position, myIntrusiveList& other) noexcept {
+    if (this == &other || other.empty()) return;
+    myListHookBase* first = other._head.next;
+    myListHookBase* last = other._head.prev;
+    other._head.prev = other._head.next = &other._head;
+    myListHookBase* pos = position._hook;
+    first->prev = pos->prev;
+    last->next = pos;
+    pos->prev->next = first;
+    pos->prev = last;
+    _size += other._size;
+    other._size = 0;
+}
+
+
+// ==========================================================
+// Implementation - Query / Internal Helpers
+// ==========================================================
+
+template <typename T, auto HookPtr>
+size_t myIntrusiveList<T, HookPtr>::size() const noexcept {
+    if constexpr (constant_time_size) {
+        return _size;
+    } else {
+        // auto_unlink 钩子可以绕过链表自行摘下：只能数一遍
+        size_t n = 0;
+        for (const myListHookBase* hook = _head.next; hook != &_head; hook = hook->next) ++ n;
+        return n;
+    }
+}
+
+template <typename T, auto HookPtr>
+void myIntrusiveList<T, HookPtr>::unlink_hook(myListHookBase* hook) noexcept {
+    hook->prev->next = hook->next;
+    hook->next->prev = hook->prev;
+    if constexpr (mode != myLinkMode::normal) {
+        hook->prev = hook->next = nullptr;
+    }
+}
+
+template <typename T, auto HookPtr>
+void myIntrusiveList<T, HookPtr>::relink(myListHookBase& to, myListHookBase& from) noexcept {
+    if (from.next != &from) {
+        to.next = from.next;
+        to.prev = from.prev;
+        to.next->prev = &to;
+        to.prev->next = &to;
+    } else {
+        to.next = to.prev = &to;
+    }
+    from.next = from.prev = &from;
+}
+
+#endif // MY_INTRUSIVE_LIST_H
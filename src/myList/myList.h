@@ -3,22 +3,33 @@
 
 #include <iostream>
 #include <cstddef>
+#include <memory>       // std::allocator, std::allocator_traits
+#include <utility>      // std::swap, std::forward, std::in_place
+#include <functional>   // std::less, std::equal_to
+
+// 只含指针的节点基类：哨兵就是一个 ListNodeBase，不含 T，也就不需要 T 可默认构造
+class ListNodeBase {
+public:
+    ListNodeBase *prev, *next;
+    ListNodeBase() : prev(nullptr), next(nullptr) {}
+};
 
 template <typename T>
-class ListNode {
+class ListNode : public ListNodeBase {
 public:
     T data;
-    ListNode *prev, *next;
-    ListNode() : prev(nullptr), next(nullptr) {}
-    ListNode(const T& value) : data(value), prev(nullptr), next(nullptr) {}
+    // 参数原样转发给 T 的构造函数，元素直接在节点内构造（in_place_t 避免与拷贝构造混淆）
+    template <typename ... Args>
+    explicit ListNode(std::in_place_t, Args&& ... args) : ListNodeBase(), data(std::forward<Args>(args)...) {}
 };
 
 template <typename T>
 class myList_iterator {
 public:
-    ListNode<T> *current;
-    myList_iterator(ListNode<T> *node) : current(node) {}
-    T& operator*() { return current->data; }
+    ListNodeBase *current;
+    myList_iterator(ListNodeBase *node) : current(node) {}
+    T& operator*() { return static_cast<ListNode<T>*>(current)->data; }
+    T* operator->() { return &static_cast<ListNode<T>*>(current)->data; }
     // 自增和自减
     myList_iterator& operator++() { current = current->next; return *this; }
     myList_iterator operator++(int) { myList_iterator temp = *this; current = current->next; return temp; }
@@ -32,9 +43,10 @@ public:
 template <typename T>
 class myList_const_iterator {
 public:
-    const ListNode<T> *current;
-    myList_const_iterator(const ListNode<T> *node) : current(node) {}
-    const T& operator*() const { return current->data; }
+    const ListNodeBase *current;
+    myList_const_iterator(const ListNodeBase *node) : current(node) {}
+    const T& operator*() const { return static_cast<const ListNode<T>*>(current)->data; }
+    const T* operator->() const { return &static_cast<const ListNode<T>*>(current)->data; }
     // 自增和自减
     myList_const_iterator& operator++() { current = current->next; return *this; }
     myList_const_iterator operator++(int) { myList_const_iterator temp = *this; current = current->next; return temp; }
@@ -65,175 +77,611 @@ bool operator!=(const myList_const_iterator<T>& lhs, const myList_iterator<T>& r
     return lhs.current != rhs.current;
 }
 
-template <typename T>
+// Alloc 为元素类型的分配器，内部 rebind 为 ListNode<T> 的分配器，元素节点都经由它分配；
+// 哨兵是内嵌在链表对象中的 ListNodeBase，不分配、不含 T。
+// 配合 myAllocator/myNodePoolAllocator.h 可让每个链表拥有自己的节点池，插入 / 删除不再逐个 new / delete。
+template <typename T, typename Alloc = std::allocator<T>>
 class myList {
-    ListNode<T> *head;
+    using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<ListNode<T>>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    ListNodeBase head;      // 哨兵：head.next 为首节点，head.prev 为尾节点
     size_t _size;
+    node_allocator _alloc;
 public:
     friend class ListTester; // 友元测试类，允许访问私有成员
     using iterator = myList_iterator<T>;
     using const_iterator = myList_const_iterator<T>;
+    using allocator_type = Alloc;
     // 五法则
     myList();
+    explicit myList(const Alloc& alloc);
     ~myList();
     myList(const myList& other);
     myList& operator = (const myList& other);
     myList(myList&& other) noexcept;
-    myList& operator = (myList&& other) noexcept;
+    myList& operator = (myList&& other) noexcept(node_traits::propagate_on_container_move_assignment::value
+                                                 || node_traits::is_always_equal::value);
     void swap(myList& other) noexcept;
-    // 数据操作
+    // 数据操作：右值版本移动进节点，emplace 系列用参数直接在节点内构造元素
     void push_front(const T& value);
+    void push_front(T&& value);
     void push_back(const T& value);
+    void push_back(T&& value);
+    template <typename ... Args>
+    T& emplace_front(Args&& ... args);
+    template <typename ... Args>
+    T& emplace_back(Args&& ... args);
     void pop_front();
     void pop_back();
     void insert(iterator position, const T& value);
+    void insert(iterator position, T&& value);
+    template <typename ... Args>
+    iterator emplace(iterator position, Args&& ... args);
     void erase(iterator position);
     void clear();
+    // 链表专有操作：只重新连接节点指针，不拷贝 / 移动元素，也不分配内存
+    // 跨链表的操作要求两个链表的分配器相等（节点由谁分配就由谁回收）
+    void splice(iterator position, myList& other);
+    void splice(iterator position, myList& other, iterator it);
+    void splice(iterator position, myList& other, iterator first, iterator last);
+    void merge(myList& other);
+    template <typename Compare>
+    void merge(myList& other, Compare comp);
+    void sort();
+    template <typename Compare>
+    void sort(Compare comp);
+    size_t remove(const T& value);
+    template <typename Pred>
+    size_t remove_if(Pred pred);
+    size_t unique();
+    template <typename BinaryPred>
+    size_t unique(BinaryPred equal);
     // 查询
     size_t size() const;
     bool empty() const;
+    Alloc get_allocator() const { return Alloc(_alloc); }
     // 迭代器
-    iterator begin() { return iterator(head->next); }
-    iterator end() { return iterator(head); }
-    const_iterator begin() const { return const_iterator(head->next); }
-    const_iterator end() const { return const_iterator(head); }
+    iterator begin() { return iterator(head.next); }
+    iterator end() { return iterator(&head); }
+    const_iterator begin() const { return const_iterator(head.next); }
+    const_iterator end() const { return const_iterator(&head); }
     
 private:
+    static T& value_of(ListNodeBase* node) { return static_cast<ListNode<T>*>(node)->data; }
+    static const T& value_of(const ListNodeBase* node) { return static_cast<const ListNode<T>*>(node)->data; }
+    // 节点分配：先分配再构造，构造失败时归还内存
+    template <typename ... Args>
+    ListNode<T>* create_node(Args&& ... args);
+    void destroy_node(ListNodeBase* node) noexcept;
+    void init_sentinel() noexcept;
+    // 把 from 哨兵上的整个环转挂到 to 上，from 变为空环
+    static void relink(ListNodeBase& to, ListNodeBase& from) noexcept;
+    // 把 [first, last) 摘下并接到 position 之前，first..last 不能包含 position
+    static void transfer(ListNodeBase* position, ListNodeBase* first, ListNodeBase* last) noexcept;
+    // 排序用的单向链（以 nullptr 结尾，只维护 next）：把 from 稳定地归并进 into
+    template <typename Compare>
+    static void merge_chains(ListNodeBase*& into, ListNodeBase*& from, Compare& comp);
+    // 把一批已摘下的单向链节点销毁
+    void destroy_chain(ListNodeBase* chain) noexcept;
     // debug
     void debugPrint() const;
 };
 
 // ------------ 五法则 ------------
-template <typename T>
-myList<T>::myList() : _size(0) {
-    head = new ListNode<T>(); // 哨兵节点
-    head->next = head;
-    head->prev = head;
+template <typename T, typename Alloc>
+myList<T, Alloc>::myList() : head(), _size(0), _alloc() {
+    init_sentinel();
 }
 
-template <typename T>
-myList<T>::~myList() {
-    myList<T>::clear();
-    delete head;
+template <typename T, typename Alloc>
+myList<T, Alloc>::myList(const Alloc& alloc) : head(), _size(0), _alloc(alloc) {
+    init_sentinel();
 }
 
-template <typename T>
-void myList<T>::swap(myList& other) noexcept {
-    std::swap(head, other.head);
+template <typename T, typename Alloc>
+myList<T, Alloc>::~myList() {
+    myList<T, Alloc>::clear();
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::swap(myList& other) noexcept {
+    // 哨兵内嵌在对象中，不能直接交换指针：首尾节点要改为指向对方的哨兵
+    ListNodeBase temp;
+    relink(temp, head);
+    relink(head, other.head);
+    relink(other.head, temp);
     std::swap(_size, other._size);
+    // 仅在 propagate_on_container_swap 时交换分配器；否则两者必须相等
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(_alloc, other._alloc);
+    }
 }
 
-template <typename T>
-myList<T>::myList(const myList& other) : _size(0) {
-    head = nullptr;
-    myList<T> temp;
-    ListNode<T> *current = other.head->next;
-    while (current != other.head) {
-        temp.push_back(current->data);
-        current = current->next;
+template <typename T, typename Alloc>
+myList<T, Alloc>::myList(const myList& other)
+    : head(), _size(0), _alloc(node_traits::select_on_container_copy_construction(other._alloc)) {
+    init_sentinel();
+    try {
+        const ListNodeBase *current = other.head.next;
+        while (current != &other.head) {
+            push_back(value_of(current));
+            current = current->next;
+        }
+    } catch (...) {
+        clear();
+        throw;
     }
-    swap(temp);
 }
 
-template <typename T>
-myList<T>& myList<T>::operator=(const myList& other) {
+template <typename T, typename Alloc>
+myList<T, Alloc>& myList<T, Alloc>::operator=(const myList& other) {
     if (this != &other) {
-        myList<T> temp(other);
-        swap(temp);
+        // 新节点用赋值后应持有的分配器构造，再连同分配器与旧节点整体交换（强保证）
+        node_allocator alloc = node_traits::propagate_on_container_copy_assignment::value ? other._alloc : _alloc;
+        myList<T, Alloc> temp{Alloc(alloc)};
+        for (const ListNodeBase *current = other.head.next; current != &other.head; current = current->next) {
+            temp.push_back(value_of(current));
+        }
+        clear();
+        relink(head, temp.head);
+        std::swap(_size, temp._size);
+        using std::swap;
+        swap(_alloc, temp._alloc);
     }
     return *this;
 }
 
-template <typename T>
-myList<T>::myList(myList&& other) noexcept : head(other.head), _size(other._size) {
-    other.head = nullptr;
+template <typename T, typename Alloc>
+myList<T, Alloc>::myList(myList&& other) noexcept : head(), _size(other._size), _alloc(other._alloc) {
+    // 移动后 other 是合法的空链表，可以继续使用；
+    // 因此分配器要拷贝而非移动（标准要求移动后的分配器与原值相等，如节点池的 shared_ptr 不能被掏空）
+    relink(head, other.head);
     other._size = 0;
 }
 
-template <typename T>
-myList<T>& myList<T>::operator=(myList&& other) noexcept {
+// 移动赋值与 myVector 相同：
+//     - propagate_on_container_move_assignment 为真或两分配器相等：释放自己的节点，直接接管对方的节点环
+//     - 否则对方的节点只能由对方的分配器回收，只能用自己的分配器逐元素移动构造新节点
+template <typename T, typename Alloc>
+myList<T, Alloc>& myList<T, Alloc>::operator=(myList&& other)
+    noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value) {
     if (this != &other) {
-        swap(other);
+        clear();
+        if constexpr (!node_traits::propagate_on_container_move_assignment::value && !node_traits::is_always_equal::value) {
+            if (_alloc != other._alloc) {
+                for (ListNodeBase *current = other.head.next; current != &other.head; current = current->next) {
+                    emplace_back(std::move(value_of(current)));
+                }
+                other.clear();
+                return *this;
+            }
+        }
+        if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+            _alloc = other._alloc;      // 拷贝而非移动：other 仍要用它继续工作
+        }
+        relink(head, other.head);
+        _size = other._size;
+        other._size = 0;
     }
     return *this;
 }
 
 // --------------------- 数据操作 ---------------------
-template <typename T>
-void myList<T>::push_front(const T& value) {
-    insert(iterator(head->next), value);
+template <typename T, typename Alloc>
+void myList<T, Alloc>::push_front(const T& value) {
+    emplace(iterator(head.next), value);
 }
 
-template <typename T>
-void myList<T>::push_back(const T& value) {
-    insert(iterator(head), value);
+template <typename T, typename Alloc>
+void myList<T, Alloc>::push_front(T&& value) {
+    emplace(iterator(head.next), std::move(value));
 }
 
-template <typename T>
-void myList<T>::pop_front() {
+template <typename T, typename Alloc>
+void myList<T, Alloc>::push_back(const T& value) {
+    emplace(iterator(&head), value);
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::push_back(T&& value) {
+    emplace(iterator(&head), std::move(value));
+}
+
+template <typename T, typename Alloc>
+template <typename ... Args>
+T& myList<T, Alloc>::emplace_front(Args&& ... args) {
+    return *emplace(iterator(head.next), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Alloc>
+template <typename ... Args>
+T& myList<T, Alloc>::emplace_back(Args&& ... args) {
+    return *emplace(iterator(&head), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::pop_front() {
     if (_size > 0) {
-        erase(iterator(head->next));
+        erase(iterator(head.next));
     }
 }
 
-template <typename T>
-void myList<T>::pop_back() {
+template <typename T, typename Alloc>
+void myList<T, Alloc>::pop_back() {
     if (_size > 0) {
-        erase(iterator(head->prev));
+        erase(iterator(head.prev));
     }
 }
 
-template <typename T>
-void myList<T>::insert(iterator position, const T& value) {
-    ListNode<T> *newNode = new ListNode<T>(value);
-    ListNode<T> *posNode = position.current;
+template <typename T, typename Alloc>
+void myList<T, Alloc>::insert(iterator position, const T& value) {
+    emplace(position, value);
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::insert(iterator position, T&& value) {
+    emplace(position, std::move(value));
+}
+
+template <typename T, typename Alloc>
+template <typename ... Args>
+typename myList<T, Alloc>::iterator myList<T, Alloc>::emplace(iterator position, Args&& ... args) {
+    // 先构造好节点再链接：构造抛异常时链表不变
+    ListNodeBase *newNode = create_node(std::forward<Args>(args)...);
+    ListNodeBase *posNode = position.current;
     newNode->prev = posNode->prev;
     newNode->next = posNode;
     posNode->prev->next = newNode;
     posNode->prev = newNode;
     ++ _size;
+    return iterator(newNode);
 }
 
-template <typename T>
-void myList<T>::erase(iterator position) {
-    if (position.current == head) return ;
+template <typename T, typename Alloc>
+void myList<T, Alloc>::erase(iterator position) {
+    if (position.current == &head) return ;
     position.current->next->prev = position.current->prev;
     position.current->prev->next = position.current->next;
-    delete position.current;
+    destroy_node(position.current);
     -- _size;
 }
 
-template <typename T>
-void myList<T>::clear() {
-    if (head == nullptr) return;
-    ListNode<T> *current = head->next;
-    while (current != head) {
-        ListNode<T> *temp = current;
+template <typename T, typename Alloc>
+void myList<T, Alloc>::clear() {
+    ListNodeBase *current = head.next;
+    while (current != &head) {
+        ListNodeBase *temp = current;
         current = current->next;
-        delete temp;
+        destroy_node(temp);
     }
-    head->next = head;
-    head->prev = head;
+    head.next = &head;
+    head.prev = &head;
     _size = 0;
 }
 
+// --------------------- 链表专有操作 ---------------------
+template <typename T, typename Alloc>
+void myList<T, Alloc>::splice(iterator position, myList& other) {
+    if (this == &other || other._size == 0) return;
+    transfer(position.current, other.head.next, &other.head);
+    _size += other._size;
+    other._size = 0;
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::splice(iterator position, myList& other, iterator it) {
+    ListNodeBase *node = it.current;
+    if (position.current == node || position.current == node->next) return;
+    transfer(position.current, node, node->next);
+    if (this != &other) {
+        ++ _size;
+        -- other._size;
+    }
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::splice(iterator position, myList& other, iterator first, iterator last) {
+    if (first == last) return;
+    if (this != &other) {
+        // 跨链表时需要数出区间长度来维护 _size：O(区间长度)
+        size_t n = 0;
+        for (ListNodeBase *p = first.current; p != last.current; p = p->next) ++ n;
+        _size += n;
+        other._size -= n;
+    }
+    transfer(position.current, first.current, last.current);
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::merge(myList& other) {
+    merge(other, std::less<>());
+}
+
+template <typename T, typename Alloc>
+template <typename Compare>
+void myList<T, Alloc>::merge(myList& other, Compare comp) {
+    if (this == &other) return;
+    // 逐个把 other 中更小的节点接到当前位置之前；相等时 this 的元素在前（稳定）
+    // 比较抛异常时已转移的节点留在 this，其余仍在 other，两边的 _size 都正确
+    ListNodeBase *first1 = head.next;
+    ListNodeBase *first2 = other.head.next;
+    while (first1 != &head && first2 != &other.head) {
+        if (comp(value_of(first2), value_of(first1))) {
+            ListNodeBase *next = first2->next;
+            transfer(first1, first2, next);
+            ++ _size;
+            -- other._size;
+            first2 = next;
+        } else {
+            first1 = first1->next;
+        }
+    }
+    if (first2 != &other.head) {
+        splice(end(), other);
+    }
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::sort() {
+    sort(std::less<>());
+}
+
+template <typename T, typename Alloc>
+template <typename Compare>
+void myList<T, Alloc>::sort(Compare comp) {
+    if (_size < 2) return;
+    // 自底向上归并排序：bucket[i] 为空或保存 2^i 个已排序节点。
+    // 每取下一个节点作为 carry，像二进制加一那样与 bucket[0], bucket[1], ... 逐级归并进位。
+    // 全程只改 next 指针，最后统一修复 prev；64 个桶足以容纳任何 size_t 长度。
+    ListNodeBase *bucket[64] = {};
+    ListNodeBase *carry = nullptr;
+    ListNodeBase *rest = head.next;
+    head.prev->next = nullptr;
+    try {
+        while (rest != nullptr) {
+            carry = rest;
+            rest = rest->next;
+            carry->next = nullptr;
+            size_t i = 0;
+            for (; bucket[i] != nullptr; ++i) {
+                // bucket[i] 中的元素更早出现，作为 into 保证稳定
+                merge_chains(bucket[i], carry, comp);
+                carry = bucket[i];
+                bucket[i] = nullptr;
+            }
+            bucket[i] = carry;
+            carry = nullptr;
+        }
+        // 低位桶中是较晚的元素：从低到高依次并入更早的高位桶
+        for (size_t i = 1; i < 64; ++i) {
+            if (bucket[i] != nullptr) {
+                merge_chains(bucket[i], bucket[i - 1], comp);
+            } else {
+                bucket[i] = bucket[i - 1];
+            }
+            bucket[i - 1] = nullptr;
+        }
+    } catch (...) {
+        // 比较抛异常：把所有链重新接回链表（顺序未定义，但不丢失节点）
+        ListNodeBase *all = rest;
+        auto append = [&all](ListNodeBase *chain) {
+            if (chain == nullptr) return;
+            ListNodeBase *tail = chain;
+            while (tail->next != nullptr) tail = tail->next;
+            tail->next = all;
+            all = chain;
+        };
+        append(carry);
+        for (ListNodeBase *chain : bucket) append(chain);
+        bucket[63] = all;
+        ListNodeBase *prev = &head;
+        for (ListNodeBase *p = bucket[63]; p != nullptr; p = p->next) {
+            prev->next = p;
+            p->prev = prev;
+            prev = p;
+        }
+        prev->next = &head;
+        head.prev = prev;
+        throw;
+    }
+    // 修复 prev 指针并闭合成环
+    ListNodeBase *prev = &head;
+    for (ListNodeBase *p = bucket[63]; p != nullptr; p = p->next) {
+        prev->next = p;
+        p->prev = prev;
+        prev = p;
+    }
+    prev->next = &head;
+    head.prev = prev;
+}
+
+template <typename T, typename Alloc>
+size_t myList<T, Alloc>::remove(const T& value) {
+    // value 可能引用链表中的元素：remove_if 推迟到最后才销毁节点，比较期间 value 始终有效
+    return remove_if([&value](const T& x) { return x == value; });
+}
+
+template <typename T, typename Alloc>
+template <typename Pred>
+size_t myList<T, Alloc>::remove_if(Pred pred) {
+    // 命中的节点先摘到单向垃圾链上，遍历结束（或谓词抛异常）后统一销毁
+    ListNodeBase *trash = nullptr;
+    size_t removed = 0;
+    try {
+        ListNodeBase *current = head.next;
+        while (current != &head) {
+            ListNodeBase *next = current->next;
+            if (pred(value_of(current))) {
+                current->prev->next = next;
+                next->prev = current->prev;
+                current->next = trash;
+                trash = current;
+                ++ removed;
+            }
+            current = next;
+        }
+    } catch (...) {
+        _size -= removed;
+        destroy_chain(trash);
+        throw;
+    }
+    _size -= removed;
+    destroy_chain(trash);
+    return removed;
+}
+
+template <typename T, typename Alloc>
+size_t myList<T, Alloc>::unique() {
+    return unique(std::equal_to<>());
+}
+
+template <typename T, typename Alloc>
+template <typename BinaryPred>
+size_t myList<T, Alloc>::unique(BinaryPred equal) {
+    // 与每段的首个元素比较，删除其后连续相等的元素；销毁同样推迟到最后
+    if (_size < 2) return 0;
+    ListNodeBase *trash = nullptr;
+    size_t removed = 0;
+    try {
+        ListNodeBase *keep = head.next;
+        ListNodeBase *current = keep->next;
+        while (current != &head) {
+            ListNodeBase *next = current->next;
+            if (equal(value_of(keep), value_of(current))) {
+                keep->next = next;
+                next->prev = keep;
+                current->next = trash;
+                trash = current;
+                ++ removed;
+            } else {
+                keep = current;
+            }
+            current = next;
+        }
+    } catch (...) {
+        _size -= removed;
+        destroy_chain(trash);
+        throw;
+    }
+    _size -= removed;
+    destroy_chain(trash);
+    return removed;
+}
+
 // --------------------- 查询 ---------------------
-template <typename T>
-size_t myList<T>::size() const {
+template <typename T, typename Alloc>
+size_t myList<T, Alloc>::size() const {
     return _size;
 }
 
-template <typename T>
-bool myList<T>::empty() const {
+template <typename T, typename Alloc>
+bool myList<T, Alloc>::empty() const {
     return _size == 0;
 }
 
+// --------------------- 节点分配 ---------------------
+template <typename T, typename Alloc>
+template <typename ... Args>
+ListNode<T>* myList<T, Alloc>::create_node(Args&& ... args) {
+    ListNode<T> *node = node_traits::allocate(_alloc, 1);
+    try {
+        node_traits::construct(_alloc, node, std::in_place, std::forward<Args>(args)...);
+    } catch (...) {
+        node_traits::deallocate(_alloc, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::destroy_node(ListNodeBase* node) noexcept {
+    ListNode<T> *full = static_cast<ListNode<T>*>(node);
+    node_traits::destroy(_alloc, full);
+    node_traits::deallocate(_alloc, full, 1);
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::init_sentinel() noexcept {
+    head.next = &head;
+    head.prev = &head;
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::relink(ListNodeBase& to, ListNodeBase& from) noexcept {
+    if (from.next != &from) {
+        to.next = from.next;
+        to.prev = from.prev;
+        to.next->prev = &to;
+        to.prev->next = &to;
+    } else {
+        to.next = to.prev = &to;
+    }
+    from.next = from.prev = &from;
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::transfer(ListNodeBase* position, ListNodeBase* first, ListNodeBase* last) noexcept {
+    ListNodeBase *tail = last->prev;
+    // 从原位置摘下 [first, tail]
+    first->prev->next = last;
+    last->prev = first->prev;
+    // 接到 position 之前
+    ListNodeBase *before = position->prev;
+    before->next = first;
+    first->prev = before;
+    tail->next = position;
+    position->prev = tail;
+}
+
+template <typename T, typename Alloc>
+template <typename Compare>
+void myList<T, Alloc>::merge_chains(ListNodeBase*& into, ListNodeBase*& from, Compare& comp) {
+    // link 指向结果链末尾的 next 域，避免构造带 T 的哑节点
+    ListNodeBase *result = nullptr;
+    ListNodeBase **link = &result;
+    ListNodeBase *a = into, *b = from;
+    try {
+        while (a != nullptr && b != nullptr) {
+            if (comp(value_of(b), value_of(a))) {
+                *link = b;
+                b = b->next;
+            } else {
+                *link = a;
+                a = a->next;
+            }
+            link = &(*link)->next;
+        }
+    } catch (...) {
+        // 已归并部分 + 两条链的剩余部分仍然全部挂在 into 上，调用者不会丢失节点
+        *link = a;
+        while (*link != nullptr) link = &(*link)->next;
+        *link = b;
+        into = result;
+        from = nullptr;
+        throw;
+    }
+    *link = (a != nullptr) ? a : b;
+    into = result;
+    from = nullptr;
+}
+
+template <typename T, typename Alloc>
+void myList<T, Alloc>::destroy_chain(ListNodeBase* chain) noexcept {
+    while (chain != nullptr) {
+        ListNodeBase *next = chain->next;
+        destroy_node(chain);
+        chain = next;
+    }
+}
+
 // --------------------- Debug ---------------------
-template <typename T>
-void myList<T>::debugPrint() const {
-    ListNode<T> *current = head->next;
-    while (current != head) {
-        std::cout << current->data << " ";
+template <typename T, typename Alloc>
+void myList<T, Alloc>::debugPrint() const {
+    ListNodeBase *current = head.next;
+    while (current != &head) {
+        std::cout << value_of(current) << " ";
         current = current->next;
     }
     std::cout << std::endl;
@@ -0,0 +1,621 @@
+#ifndef MY_UNROLLED_LIST_H
+#define MY_UNROLLED_LIST_H
+
+#include <cstddef>      // size_t, ptrdiff_t
+#include <new>          // placement new
+#include <utility>      // std::move, std::forward, std::swap
+#include <memory>       // std::allocator, std::allocator_traits
+#include <iterator>     // std::bidirectional_iterator_tag
+#include <type_traits>  // std::conditional_t
+#include <functional>   // std::less, std::equal_to
+#include <algorithm>    // std::stable_sort
+#include <vector>
+
+// ==========================================================
+// myUnrolledList：展开链表，每个节点保存一小段元素数组
+// ==========================================================
+// myList<int> 每个元素一个节点：遍历时每 4 字节数据就要追一次指针，
+// 节点散落在堆上时几乎每一步都是一次 cache miss，且每个元素额外付出 16 字节的 prev/next。
+// myUnrolledList 把若干个元素放进同一个节点（节点总大小约 NodeBytes，默认 256B = 4 条 cache line）：
+//
+//  哨兵 ⇄ [ n0 | e e e e e . . ] ⇄ [ n1 | e e e e e e e ] ⇄ [ n2 | e e . . . . . ] ⇄ 哨兵
+//
+//     - 遍历：节点内连续访问，每 node_capacity 个元素才追一次指针
+//     - 插入：节点满时从中间一分为二（尾部 push_back / 头部 push_front 直接新开节点，保持节点满载）
+//     - 删除：节点元素过少时与相邻节点合并，空节点立即释放，保证空间利用率
+//     - 迭代器为 (节点, 下标) 对，双向迭代
+//
+// 与 myList 的差异：
+//     - 插入 / 删除会在节点内移动元素，并使同一节点（以及分裂 / 合并涉及的节点）上的迭代器失效；
+//       insert / erase 返回新的有效迭代器
+//     - 插入 / 删除为 O(node_capacity)，仍与总长度无关
+//     - 元素不再独占节点，splice / merge 这类 "摘节点" 的操作没有意义，因此不提供；
+//       sort 先把元素移动到连续数组中排序再移回，节点结构不变
+// 节点内存通过 Alloc rebind 后的分配器申请；哨兵内嵌在链表对象中，不单独分配。
+
+template <typename T, typename Alloc = std::allocator<T>, size_t NodeBytes = 256>
+class myUnrolledList {
+private:
+    struct NodeBase {
+        NodeBase* prev;
+        NodeBase* next;
+        size_t    count;      // 节点中已构造的元素个数；哨兵恒为 0
+    };
+
+public:
+    // 每个节点容纳的元素个数：节点总大小约 NodeBytes，至少 4 个
+    static constexpr size_t node_capacity =
+        (NodeBytes > sizeof(NodeBase) && (NodeBytes - sizeof(NodeBase)) / sizeof(T) >= 4)
+            ? (NodeBytes - sizeof(NodeBase)) / sizeof(T) : 4;
+
+private:
+    struct Node : NodeBase {
+        alignas(T) unsigned char storage[node_capacity * sizeof(T)];
+        T* data() noexcept { return reinterpret_cast<T*>(storage); }
+    };
+
+    using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    NodeBase        _head;          // 哨兵：_head.next 为首节点，_head.prev 为尾节点
+    size_t          _size;
+    size_t          _nodeCount;
+    node_allocator  _alloc;
+
+    static T* slot(NodeBase* node, size_t index) noexcept { return static_cast<Node*>(node)->data() + index; }
+
+public:
+    /* ===== 迭代器 ===== */
+    template <bool Const>
+    class basic_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() : _node(nullptr), _index(0) {}
+        basic_iterator(NodeBase* node, size_t index) : _node(node), _index(index) {}
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& other) : _node(other._node), _index(other._index) {}
+
+        reference operator*() const { return *slot(_node, _index); }
+        pointer operator->() const { return slot(_node, _index); }
+        basic_iterator& operator++() {
+            if (++ _index == _node->count) {
+                _node = _node->next;
+                _index = 0;
+            }
+            return *this;
+        }
+        basic_iterator operator++(int) { basic_iterator temp = *this; ++ *this; return temp; }
+        basic_iterator& operator--() {
+            if (_index == 0) {
+                _node = _node->prev;
+                _index = _node->count;
+            }
+            -- _index;
+            return *this;
+        }
+        basic_iterator operator--(int) { basic_iterator temp = *this; -- *this; return temp; }
+        bool operator==(const basic_iterator& other) const { return _node == other._node && _index == other._index; }
+        bool operator!=(const basic_iterator& other) const { return !(*this == other); }
+
+    private:
+        friend class myUnrolledList;
+        template <bool> friend class basic_iterator;
+        NodeBase* _node;
+        size_t _index;
+    };
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using allocator_type = Alloc;
+
+    /* ===== 构造 / 析构 ===== */
+    myUnrolledList();
+    explicit myUnrolledList(const Alloc& alloc);
+    ~myUnrolledList();
+    myUnrolledList(const myUnrolledList& other);
+    myUnrolledList& operator=(const myUnrolledList& other);
+    myUnrolledList(myUnrolledList&& other) noexcept;
+    myUnrolledList& operator=(myUnrolledList&& other) noexcept(node_traits::propagate_on_container_move_assignment::value
+                                                               || node_traits::is_always_equal::value);
+    void swap(myUnrolledList& other) noexcept;
+
+    /* ===== 修改器 ===== */
+    void push_front(const T& value) { emplace(begin(), value); }
+    void push_front(T&& value) { emplace(begin(), std::move(value)); }
+    void push_back(const T& value) { emplace(end(), value); }
+    void push_back(T&& value) { emplace(end(), std::move(value)); }
+    template <typename ... Args>
+    T& emplace_back(Args&& ... args) { return *emplace(end(), std::forward<Args>(args)...); }
+    void pop_front();
+    void pop_back();
+    iterator insert(const_iterator position, const T& value) { return emplace(position, value); }
+    iterator insert(const_iterator position, T&& value) { return emplace(position, std::move(value)); }
+    template <typename ... Args>
+    iterator emplace(const_iterator position, Args&& ... args);
+    iterator erase(const_iterator position);
+    void clear() noexcept;
+
+    /* ===== 链表操作 ===== */
+    size_t remove(const T& value);
+    template <typename Pred>
+    size_t remove_if(Pred pred);
+    size_t unique();
+    template <typename BinaryPred>
+    size_t unique(BinaryPred equal);
+    void sort();
+    template <typename Compare>
+    void sort(Compare comp);
+
+    /* ===== 查询 ===== */
+    size_t size() const noexcept { return _size; }
+    bool empty() const noexcept { return _size == 0; }
+    size_t node_count() const noexcept { return _nodeCount; }
+    T& front() { return *slot(_head.next, 0); }
+    const T& front() const { return *slot(_head.next, 0); }
+    T& back() { return *slot(_head.prev, _head.prev->count - 1); }
+    const T& back() const { return *slot(_head.prev, _head.prev->count - 1); }
+    Alloc get_allocator() const { return Alloc(_alloc); }
+
+    /* ===== 迭代器 ===== */
+    iterator begin() noexcept { return iterator(_head.next, 0); }
+    iterator end() noexcept { return iterator(&_head, 0); }
+    const_iterator begin() const noexcept { return const_iterator(_head.next, 0); }
+    const_iterator end() const noexcept { return const_iterator(const_cast<NodeBase*>(&_head), 0); }
+
+private:
+    /* ===== 内部工具 ===== */
+    void reset_head() noexcept;
+    static void relink(NodeBase& to, NodeBase& from) noexcept;    // 把 from 哨兵上的环转挂到 to 上
+    void adopt(myUnrolledList& other) noexcept;     // 接管 other 的全部节点，other 变为空
+    NodeBase* create_node(NodeBase* before);        // 在 before 之前链入一个空节点
+    void destroy_node(NodeBase* node) noexcept;     // 摘下并释放一个空节点
+    // 把 from 中下标 [first, from->count) 的元素移动到 to 末尾
+    static void move_tail(NodeBase* from, size_t first, NodeBase* to);
+    // remove_if / unique 的公共实现：drop(x, 最近保留的元素或 nullptr) 为真则删除 x
+    template <typename Drop>
+    size_t compact(Drop drop);
+    // 删除后节点过稀时与相邻节点合并；返回原 (node, index) 位置在合并后的新迭代器
+    iterator rebalance(NodeBase* node, size_t index);
+};
+
+
+// ==========================================================
+// Implementation - Constructors / Destructor
+// ==========================================================
+
+template <typename T, typename Alloc, size_t NodeBytes>
+myUnrolledList<T, Alloc, NodeBytes>::myUnrolledList() : _size(0), _nodeCount(0), _alloc() {
+    reset_head();
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+myUnrolledList<T, Alloc, NodeBytes>::myUnrolledList(const Alloc& alloc) : _size(0), _nodeCount(0), _alloc(alloc) {
+    reset_head();
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+myUnrolledList<T, Alloc, NodeBytes>::~myUnrolledList() {
+    clear();
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+myUnrolledList<T, Alloc, NodeBytes>::myUnrolledList(const myUnrolledList& other)
+    : _size(0), _nodeCount(0), _alloc(node_traits::select_on_container_copy_construction(other._alloc)) {
+    reset_head();
+    try {
+        for (const T& value : other) {
+            push_back(value);
+        }
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+myUnrolledList<T, Alloc, NodeBytes>& myUnrolledList<T, Alloc, NodeBytes>::operator=(const myUnrolledList& other) {
+    if (this != &other) {
+        node_allocator alloc = node_traits::propagate_on_container_copy_assignment::value ? other._alloc : _alloc;
+        myUnrolledList temp{Alloc(alloc)};
+        for (const T& value : other) {
+            temp.push_back(value);
+        }
+        clear();
+        _alloc = temp._alloc;
+        adopt(temp);
+    }
+    return *this;
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+myUnrolledList<T, Alloc, NodeBytes>::myUnrolledList(myUnrolledList&& other) noexcept
+    : _size(0), _nodeCount(0), _alloc(other._alloc) {
+    // 分配器拷贝而非移动：标准要求移动后源分配器仍与原值相等，other 还要继续用它分配节点
+    reset_head();
+    adopt(other);
+}
+
+// 分配器传播或两者相等时接管对方的节点；否则对方的节点只能由对方的分配器回收，逐元素移动
+template <typename T, typename Alloc, size_t NodeBytes>
+myUnrolledList<T, Alloc, NodeBytes>& myUnrolledList<T, Alloc, NodeBytes>::operator=(myUnrolledList&& other)
+    noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value) {
+    if (this != &other) {
+        clear();
+        if constexpr (!node_traits::propagate_on_container_move_assignment::value && !node_traits::is_always_equal::value) {
+            if (_alloc != other._alloc) {
+                for (T& value : other) {
+                    push_back(std::move(value));
+                }
+                other.clear();
+                return *this;
+            }
+        }
+        if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+            _alloc = other._alloc;
+        }
+        adopt(other);
+    }
+    return *this;
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+void myUnrolledList<T, Alloc, NodeBytes>::swap(myUnrolledList& other) noexcept {
+    // 哨兵内嵌在对象中，不能直接交换指针：首尾节点要改为指向对方的哨兵
+    NodeBase temp;
+    relink(temp, _head);
+    relink(_head, other._head);
+    relink(other._head, temp);
+    std::swap(_size, other._size);
+    std::swap(_nodeCount, other._nodeCount);
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(_alloc, other._alloc);
+    }
+}
+
+
+// ==========================================================
+// Implementation - Modifiers
+// ==========================================================
+
+template <typename T, typename Alloc, size_t NodeBytes>
+template <typename ... Args>
+typename myUnrolledList<T, Alloc, NodeBytes>::iterator
+myUnrolledList<T, Alloc, NodeBytes>::emplace(const_iterator position, Args&& ... args) {
+    NodeBase* node = position._node;
+    size_t index = position._index;
+
+    // 追加类插入：写到某个节点末尾，不移动任何已有元素，直接在槽位上构造
+    //     - end()：写入尾节点，尾节点已满则在末尾新开节点（顺序 push_back 使节点保持满载）
+    //     - 满节点的开头：前一节点有空位则追加到它末尾；是首节点则在其前面新开节点
+    bool append = false;
+    if (node == &_head) {
+        node = _head.prev;
+        append = true;
+        if (node == &_head || node->count == node_capacity) {
+            node = create_node(&_head);
+        }
+    } else if (index == 0 && node->count == node_capacity) {
+        if (node->prev == &_head) {
+            node = create_node(node);
+            append = true;
+        } else if (node->prev->count < node_capacity) {
+            node = node->prev;
+            append = true;
+        }
+    }
+    if (append) {
+        try {
+            ::new (static_cast<void*>(slot(node, node->count))) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if (node->count == 0) destroy_node(node);
+            throw;
+        }
+        ++ _size;
+        return iterator(node, node->count ++);
+    }
+
+    // 中间插入：先构造出新值（参数可能引用本链表中的元素，分裂 / 后移之后就不再有效）
+    T value(std::forward<Args>(args)...);
+    if (node->count == node_capacity) {
+        // 满节点一分为二：后半段移入新节点，再决定插入哪一半
+        NodeBase* right = create_node(node->next);
+        size_t half = node_capacity / 2;
+        try {
+            move_tail(node, half, right);
+        } catch (...) {
+            if (right->count == 0) destroy_node(right);
+            throw;
+        }
+        if (index > half) {
+            node = right;
+            index -= half;
+        }
+    }
+    T* base = slot(node, 0);
+    size_t count = node->count;
+    if (index == count) {
+        ::new (static_cast<void*>(base + count)) T(std::move(value));
+        ++ node->count;
+    } else {
+        ::new (static_cast<void*>(base + count)) T(std::move(base[count - 1]));
+        ++ node->count;
+        for (size_t i = count - 1; i > index; -- i) {
+            base[i] = std::move(base[i - 1]);
+        }
+        base[index] = std::move(value);
+    }
+    ++ _size;
+    return iterator(node, index);
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+typename myUnrolledList<T, Alloc, NodeBytes>::iterator
+myUnrolledList<T, Alloc, NodeBytes>::erase(const_iterator position) {
+    NodeBase* node = position._node;
+    size_t index = position._index;
+    if (node == &_head) return end();
+    T* base = slot(node, 0);
+    for (size_t i = index + 1; i < node->count; ++ i) {
+        base[i - 1] = std::move(base[i]);
+    }
+    base[node->count - 1].~T();
+    -- node->count;
+    -- _size;
+    return rebalance(node, index);
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+void myUnrolledList<T, Alloc, NodeBytes>::pop_front() {
+    if (_size > 0) {
+        erase(begin());
+    }
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+void myUnrolledList<T, Alloc, NodeBytes>::pop_back() {
+    if (_size > 0) {
+        // 尾部删除不移动元素，也不合并：只在节点变空时释放
+        NodeBase* node = _head.prev;
+        slot(node, node->count - 1)->~T();
+        -- _size;
+        if (-- node->count == 0) {
+            destroy_node(node);
+        }
+    }
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+void myUnrolledList<T, Alloc, NodeBytes>::clear() noexcept {
+    while (_head.next != &_head) {
+        NodeBase* node = _head.next;
+        T* base = slot(node, 0);
+        for (size_t i = 0; i < node->count; ++ i) {
+            base[i].~T();
+        }
+        node->count = 0;
+        destroy_node(node);
+    }
+    _size = 0;
+}
+
+
+// ==========================================================
+// Implementation - List Operations
+// ==========================================================
+
+template <typename T, typename Alloc, size_t NodeBytes>
+size_t myUnrolledList<T, Alloc, NodeBytes>::remove(const T& value) {
+    // value 可能引用本链表中的元素：先拷贝一份再比较
+    T copy(value);
+    return remove_if([&copy](const T& x) { return x == copy; });
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+template <typename Pred>
+size_t myUnrolledList<T, Alloc, NodeBytes>::remove_if(Pred pred) {
+    return compact([&pred](const T& x, const T*) { return pred(x); });
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+size_t myUnrolledList<T, Alloc, NodeBytes>::unique() {
+    return unique(std::equal_to<>());
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+template <typename BinaryPred>
+size_t myUnrolledList<T, Alloc, NodeBytes>::unique(BinaryPred equal) {
+    return compact([&equal](const T& x, const T* kept) { return kept != nullptr && equal(*kept, x); });
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+void myUnrolledList<T, Alloc, NodeBytes>::sort() {
+    sort(std::less<>());
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+template <typename Compare>
+void myUnrolledList<T, Alloc, NodeBytes>::sort(Compare comp) {
+    // 元素移到连续数组中稳定排序后按原位置移回，节点结构不变
+    if (_size < 2) return;
+    std::vector<T> buffer;
+    buffer.reserve(_size);
+    for (T& value : *this) {
+        buffer.push_back(std::move(value));
+    }
+    std::stable_sort(buffer.begin(), buffer.end(), comp);
+    size_t i = 0;
+    for (T& value : *this) {
+        value = std::move(buffer[i ++]);
+    }
+}
+
+
+// ==========================================================
+// Implementation - Internal Helpers
+// ==========================================================
+
+template <typename T, typename Alloc, size_t NodeBytes>
+template <typename Drop>
+size_t myUnrolledList<T, Alloc, NodeBytes>::compact(Drop drop) {
+    // 逐节点原地压缩（与 myVector::erase_if 相同的单趟读写下标）；
+    // 空节点释放，过稀节点并入前一个（已处理过的）节点，不影响后续遍历
+    size_t removed = 0;
+    const T* kept = nullptr;        // 最近保留的元素
+    NodeBase* node = _head.next;
+    while (node != &_head) {
+        T* base = slot(node, 0);
+        size_t write = 0, read = 0;
+        try {
+            for (; read < node->count; ++ read) {
+                if (!drop(base[read], kept)) {
+                    if (write != read) base[write] = std::move(base[read]);
+                    kept = base + write;
+                    ++ write;
+                }
+            }
+        } catch (...) {
+            // 谓词抛异常：把尚未检查的元素前移补上空洞，链表保持一致
+            for (; read < node->count; ++ read, ++ write) {
+                if (write != read) base[write] = std::move(base[read]);
+            }
+            for (size_t i = write; i < node->count; ++ i) base[i].~T();
+            removed += node->count - write;
+            _size -= node->count - write;
+            node->count = write;
+            throw;
+        }
+        for (size_t i = write; i < node->count; ++ i) base[i].~T();
+        removed += node->count - write;
+        _size -= node->count - write;
+        node->count = write;
+
+        NodeBase* next = node->next;
+        NodeBase* prev = node->prev;
+        if (write == 0) {
+            destroy_node(node);
+        } else if (write < node_capacity / 4 && prev != &_head && prev->count + write <= node_capacity / 2) {
+            move_tail(node, 0, prev);
+            destroy_node(node);
+            kept = slot(prev, prev->count - 1);
+        }
+        node = next;
+    }
+    return removed;
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+void myUnrolledList<T, Alloc, NodeBytes>::reset_head() noexcept {
+    _head.prev = &_head;
+    _head.next = &_head;
+    _head.count = 0;
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+void myUnrolledList<T, Alloc, NodeBytes>::relink(NodeBase& to, NodeBase& from) noexcept {
+    if (from.next != &from) {
+        to.next = from.next;
+        to.prev = from.prev;
+        to.next->prev = &to;
+        to.prev->next = &to;
+    } else {
+        to.next = to.prev = &to;
+    }
+    from.next = from.prev = &from;
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+void myUnrolledList<T, Alloc, NodeBytes>::adopt(myUnrolledList& other) noexcept {
+    // 调用前 this 必须为空；节点由 other 的分配器分配，调用者保证两者相等或已转移分配器
+    relink(_head, other._head);
+    _size = other._size;
+    _nodeCount = other._nodeCount;
+    other._size = 0;
+    other._nodeCount = 0;
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+typename myUnrolledList<T, Alloc, NodeBytes>::NodeBase*
+myUnrolledList<T, Alloc, NodeBytes>::create_node(NodeBase* before) {
+    Node* node = node_traits::allocate(_alloc, 1);
+    ::new (static_cast<void*>(node)) Node;
+    node->count = 0;
+    node->next = before;
+    node->prev = before->prev;
+    before->prev->next = node;
+    before->prev = node;
+    ++ _nodeCount;
+    return node;
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+void myUnrolledList<T, Alloc, NodeBytes>::destroy_node(NodeBase* node) noexcept {
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    Node* full = static_cast<Node*>(node);
+    full->~Node();
+    node_traits::deallocate(_alloc, full, 1);
+    -- _nodeCount;
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+void myUnrolledList<T, Alloc, NodeBytes>::move_tail(NodeBase* from, size_t first, NodeBase* to) {
+    // 移动构造中途抛异常时：析构已构造的目标元素、恢复 to->count，源元素全部保留（可能已被移走内容），
+    // 两个节点的 count 与 _size 保持一致（基本保证）
+    T* src = slot(from, 0);
+    T* dst = slot(to, 0);
+    size_t oldCount = to->count;
+    try {
+        for (size_t i = first; i < from->count; ++ i) {
+            ::new (static_cast<void*>(dst + to->count)) T(std::move(src[i]));
+            ++ to->count;
+        }
+    } catch (...) {
+        for (size_t i = oldCount; i < to->count; ++ i) {
+            dst[i].~T();
+        }
+        to->count = oldCount;
+        throw;
+    }
+    for (size_t i = first; i < from->count; ++ i) {
+        src[i].~T();
+    }
+    from->count = first;
+}
+
+template <typename T, typename Alloc, size_t NodeBytes>
+typename myUnrolledList<T, Alloc, NodeBytes>::iterator
+myUnrolledList<T, Alloc, NodeBytes>::rebalance(NodeBase* node, size_t index) {
+    // 返回的迭代器指向原 (node, index) 处的元素；index == count 时即下一个元素
+    auto result = [&](NodeBase* n, size_t i) {
+        return (i < n->count) ? iterator(n, i) : iterator(n->next, 0);
+    };
+    if (node->count == 0) {
+        NodeBase* next = node->next;
+        destroy_node(node);
+        return iterator(next, 0);
+    }
+    if (node->count >= node_capacity / 4) {
+        return result(node, index);
+    }
+    // 过稀：优先并入前一节点，否则吸收后一节点；合并后不超过半满，给后续插入留出空间
+    NodeBase* prev = node->prev;
+    if (prev != &_head && prev->count + node->count <= node_capacity / 2) {
+        size_t offset = prev->count;
+        move_tail(node, 0, prev);
+        destroy_node(node);
+        return result(prev, offset + index);
+    }
+    NodeBase* next = node->next;
+    if (next != &_head && next->count + node->count <= node_capacity / 2) {
+        move_tail(next, 0, node);
+        destroy_node(next);
+    }
+    return result(node, index);
+}
+
+#endif // MY_UNROLLED_LIST_H
@@ -0,0 +1,67 @@
+#ifndef MY_GROWTH_POLICY_H
+#define MY_GROWTH_POLICY_H
+
+#include <cstddef>      // size_t
+
+// ==========================================================
+// 扩容策略 (Growth Policy)
+// ==========================================================
+// myVector 在容量不足时统一调用：
+//     static size_t grow(size_t capacity, size_t required, size_t elemSize);
+// capacity 为当前容量，required 为本次操作所需的最小容量，elemSize 为 sizeof(T)。
+// 返回值不得小于 required。
+//
+// 倍数越大，扩容次数越少（吞吐越高），但最坏情况下浪费的内存越多：
+//     2x    -> 最多浪费 50%，且新块永远大于之前释放的所有块之和，无法复用旧块
+//     1.5x  -> 最多浪费 33%，若干次扩容后可以复用之前释放的内存
+//     黄金比 -> 复用旧块的理论临界点 (~1.618)
+
+// 2 倍扩容（默认，与原实现一致）
+struct myGrowthDoubling {
+    static size_t grow(size_t capacity, size_t required, size_t /*elemSize*/) {
+        size_t next = (capacity == 0) ? 1 : capacity * 2;
+        return next < required ? required : next;
+    }
+};
+
+// 1.5 倍扩容（MSVC / folly 风格）
+struct myGrowthOneAndHalf {
+    static size_t grow(size_t capacity, size_t required, size_t /*elemSize*/) {
+        size_t next = (capacity < 2) ? capacity + 1 : capacity + capacity / 2;
+        return next < required ? required : next;
+    }
+};
+
+// 近似黄金比例扩容：capacity * 1.625
+struct myGrowthGoldenRatio {
+    static size_t grow(size_t capacity, size_t required, size_t /*elemSize*/) {
+        size_t next = (capacity < 2) ? capacity + 1 : capacity + (capacity >> 1) + (capacity >> 3);
+        return next < required ? required : next;
+    }
+};
+
+// 在 Base 的基础上把字节数向上取整到页大小，避免大块分配末尾的零头页被浪费
+template <typename Base = myGrowthDoubling, size_t PageSize = 4096>
+struct myGrowthPageRounded {
+    static size_t grow(size_t capacity, size_t required, size_t elemSize) {
+        size_t next = Base::grow(capacity, required, elemSize);
+        size_t bytes = next * elemSize;
+        if (bytes < PageSize) {
+            return next; // 小块交给分配器，不做取整
+        }
+        bytes = (bytes + PageSize - 1) / PageSize * PageSize;
+        return bytes / elemSize;
+    }
+};
+
+// 固定步长扩容：每次增加 Step 个元素，内存浪费有上界但扩容次数为 O(N / Step)
+template <size_t Step>
+struct myGrowthFixedStep {
+    static_assert(Step > 0, "Step must be positive");
+    static size_t grow(size_t capacity, size_t required, size_t /*elemSize*/) {
+        size_t next = capacity + Step;
+        return next < required ? required : next;
+    }
+};
+
+#endif // MY_GROWTH_POLICY_H
@@ -13,7 +13,9 @@ intVector::intVector(size_t size) : _data(new int[size]), _size(size), _capacity
 }
 
 intVector::intVector(const intVector& other) : _data(new int[other._capacity]), _size(other._size), _capacity(other._capacity) {
-    std::memcpy(_data, other._data, _size * sizeof(int));
+    if (_size > 0) {
+        std::memcpy(_data, other._data, _size * sizeof(int));
+    }
 }
 
 intVector& intVector::operator= (intVector other) {
@@ -97,7 +99,9 @@ void intVector::reallocate(size_t newCapacity) {
 
     int *newData = new int[newCapacity];
 
-    std::memcpy(newData, _data, _size * sizeof(int));
+    if (_size > 0) {
+        std::memcpy(newData, _data, _size * sizeof(int));
+    }
     delete[] _data;
     _data = newData;
     _capacity = newCapacity;
@@ -0,0 +1,465 @@
+#include "intVectorSimd.h"
+#include <stdexcept>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MY_INTVECTOR_X86_SIMD 1
+#include <immintrin.h>
+#define MY_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define MY_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MY_INTVECTOR_X86_SIMD 0
+#endif
+
+namespace intKernels {
+namespace {
+
+// 32 位补码回绕运算（有符号溢出在 C++ 中是未定义行为，统一经 unsigned 计算）
+inline int wrap_add(int a, int b) { return static_cast<int>(static_cast<unsigned>(a) + static_cast<unsigned>(b)); }
+inline int wrap_mul(int a, int b) { return static_cast<int>(static_cast<unsigned>(a) * static_cast<unsigned>(b)); }
+
+// ==========================================================
+// Scalar
+// ==========================================================
+
+long long sum_scalar(const int* p, size_t n) {
+    long long total = 0;
+    for (size_t i = 0; i < n; ++ i) total += p[i];
+    return total;
+}
+
+int min_scalar(const int* p, size_t n) {
+    int m = p[0];
+    for (size_t i = 1; i < n; ++ i) m = p[i] < m ? p[i] : m;
+    return m;
+}
+
+int max_scalar(const int* p, size_t n) {
+    int m = p[0];
+    for (size_t i = 1; i < n; ++ i) m = p[i] > m ? p[i] : m;
+    return m;
+}
+
+size_t find_scalar(const int* p, size_t n, int value) {
+    for (size_t i = 0; i < n; ++ i) {
+        if (p[i] == value) return i;
+    }
+    return n;
+}
+
+size_t count_scalar(const int* p, size_t n, int value) {
+    size_t total = 0;
+    for (size_t i = 0; i < n; ++ i) total += (p[i] == value);
+    return total;
+}
+
+void add_scalar(int* dst, const int* src, size_t n) {
+    for (size_t i = 0; i < n; ++ i) dst[i] = wrap_add(dst[i], src[i]);
+}
+
+void scale_scalar(int* p, size_t n, int factor) {
+    for (size_t i = 0; i < n; ++ i) p[i] = wrap_mul(p[i], factor);
+}
+
+void prefix_sum_scalar(int* p, size_t n, int carry) {
+    for (size_t i = 0; i < n; ++ i) {
+        carry = wrap_add(carry, p[i]);
+        p[i] = carry;
+    }
+}
+
+size_t filter_scalar(const int* src, size_t n, int lo, int hi, int* out) {
+    size_t k = 0;
+    for (size_t i = 0; i < n; ++ i) {
+        out[k] = src[i];
+        k += (src[i] >= lo && src[i] <= hi); // 无分支：总是写入，命中才前进
+    }
+    return k;
+}
+
+#if MY_INTVECTOR_X86_SIMD
+
+// filter 的压缩查找表：掩码 -> 把命中元素挪到前面的排列
+struct CompressTables {
+    alignas(32) int avx2[256][8];           // _mm256_permutevar8x32_epi32 的下标
+    alignas(16) unsigned char sse[16][16];  // _mm_shuffle_epi8 的字节下标
+    unsigned char popcount[256];
+
+    CompressTables() {
+        for (int mask = 0; mask < 256; ++ mask) {
+            int k = 0;
+            for (int lane = 0; lane < 8; ++ lane) {
+                if (mask & (1 << lane)) avx2[mask][k ++] = lane;
+            }
+            popcount[mask] = static_cast<unsigned char>(k);
+            while (k < 8) avx2[mask][k ++] = 0;
+        }
+        for (int mask = 0; mask < 16; ++ mask) {
+            int k = 0;
+            for (int lane = 0; lane < 4; ++ lane) {
+                if (mask & (1 << lane)) {
+                    for (int b = 0; b < 4; ++ b) sse[mask][k * 4 + b] = static_cast<unsigned char>(lane * 4 + b);
+                    k ++;
+                }
+            }
+            for (int b = k * 4; b < 16; ++ b) sse[mask][b] = 0x80;
+        }
+    }
+};
+
+const CompressTables& compress_tables() {
+    static const CompressTables tables;
+    return tables;
+}
+
+// ==========================================================
+// SSE4.1
+// ==========================================================
+
+MY_TARGET_SSE41 long long sum_sse41(const int* p, size_t n) {
+    __m128i acc0 = _mm_setzero_si128(), acc1 = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        acc0 = _mm_add_epi64(acc0, _mm_cvtepi32_epi64(v));
+        acc1 = _mm_add_epi64(acc1, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+    }
+    alignas(16) long long lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi64(acc0, acc1));
+    return lanes[0] + lanes[1] + sum_scalar(p + i, n - i);
+}
+
+MY_TARGET_SSE41 int min_sse41(const int* p, size_t n) {
+    if (n < 4) return min_scalar(p, n);
+    __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    size_t i = 4;
+    for (; i + 4 <= n; i += 4) m = _mm_min_epi32(m, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)));
+    alignas(16) int lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), m);
+    int result = min_scalar(lanes, 4);
+    return i < n ? (result < min_scalar(p + i, n - i) ? result : min_scalar(p + i, n - i)) : result;
+}
+
+MY_TARGET_SSE41 int max_sse41(const int* p, size_t n) {
+    if (n < 4) return max_scalar(p, n);
+    __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    size_t i = 4;
+    for (; i + 4 <= n; i += 4) m = _mm_max_epi32(m, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)));
+    alignas(16) int lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), m);
+    int result = max_scalar(lanes, 4);
+    return i < n ? (result > max_scalar(p + i, n - i) ? result : max_scalar(p + i, n - i)) : result;
+}
+
+MY_TARGET_SSE41 size_t find_sse41(const int* p, size_t n, int value) {
+    __m128i key = _mm_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), key);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+        if (mask != 0) return i + __builtin_ctz(static_cast<unsigned>(mask));
+    }
+    return i + find_scalar(p + i, n - i, value);
+}
+
+MY_TARGET_SSE41 size_t count_sse41(const int* p, size_t n, int value) {
+    __m128i key = _mm_set1_epi32(value);
+    size_t total = 0;
+    size_t i = 0;
+    while (i + 4 <= n) {
+        // 每个 32 位计数器每轮最多 +1，超过 2^32 - 1 轮时分块汇总避免溢出
+        size_t blockEnd = (n - i) / 4 > 0xFFFFFFFFu ? i + size_t(4) * 0xFFFFFFFFu : n;
+        __m128i acc = _mm_setzero_si128();
+        for (; i + 4 <= blockEnd; i += 4) {
+            acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), key));
+        }
+        alignas(16) unsigned lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        total += size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+    }
+    return total + count_scalar(p + i, n - i, value);
+}
+
+MY_TARGET_SSE41 void add_sse41(int* dst, const int* src, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_add_epi32(a, b));
+    }
+    add_scalar(dst + i, src + i, n - i);
+}
+
+MY_TARGET_SSE41 void scale_sse41(int* p, size_t n, int factor) {
+    __m128i f = _mm_set1_epi32(factor);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), _mm_mullo_epi32(v, f));
+    }
+    scale_scalar(p + i, n - i, factor);
+}
+
+MY_TARGET_SSE41 void prefix_sum_sse41(int* p, size_t n) {
+    // 寄存器内两次移位相加得到 4 元素前缀和，再加上前一块的累计值
+    __m128i carry = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), x);
+        carry = _mm_shuffle_epi32(x, 0xFF);
+    }
+    prefix_sum_scalar(p + i, n - i, _mm_cvtsi128_si32(carry));
+}
+
+MY_TARGET_SSE41 size_t filter_sse41(const int* src, size_t n, int lo, int hi, int* out) {
+    const CompressTables& tables = compress_tables();
+    __m128i vlo = _mm_set1_epi32(lo), vhi = _mm_set1_epi32(hi);
+    size_t k = 0;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i reject = _mm_or_si128(_mm_cmpgt_epi32(vlo, x), _mm_cmpgt_epi32(x, vhi));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(reject)) ^ 0xF;
+        __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(tables.sse[mask]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k), _mm_shuffle_epi8(x, shuffle));
+        k += tables.popcount[mask];
+    }
+    return k + filter_scalar(src + i, n - i, lo, hi, out + k);
+}
+
+// ==========================================================
+// AVX2
+// ==========================================================
+
+MY_TARGET_AVX2 long long sum_avx2(const int* p, size_t n) {
+    __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    alignas(32) long long lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_scalar(p + i, n - i);
+}
+
+MY_TARGET_AVX2 int min_avx2(const int* p, size_t n) {
+    if (n < 8) return min_scalar(p, n);
+    __m256i m = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8) m = _mm256_min_epi32(m, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+    alignas(32) int lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), m);
+    int result = min_scalar(lanes, 8);
+    return i < n ? (result < min_scalar(p + i, n - i) ? result : min_scalar(p + i, n - i)) : result;
+}
+
+MY_TARGET_AVX2 int max_avx2(const int* p, size_t n) {
+    if (n < 8) return max_scalar(p, n);
+    __m256i m = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8) m = _mm256_max_epi32(m, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+    alignas(32) int lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), m);
+    int result = max_scalar(lanes, 8);
+    return i < n ? (result > max_scalar(p + i, n - i) ? result : max_scalar(p + i, n - i)) : result;
+}
+
+MY_TARGET_AVX2 size_t find_avx2(const int* p, size_t n, int value) {
+    __m256i key = _mm256_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), key);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+        if (mask != 0) return i + __builtin_ctz(static_cast<unsigned>(mask));
+    }
+    return i + find_scalar(p + i, n - i, value);
+}
+
+MY_TARGET_AVX2 size_t count_avx2(const int* p, size_t n, int value) {
+    __m256i key = _mm256_set1_epi32(value);
+    size_t total = 0;
+    size_t i = 0;
+    while (i + 8 <= n) {
+        size_t blockEnd = (n - i) / 8 > 0xFFFFFFFFu ? i + size_t(8) * 0xFFFFFFFFu : n;
+        __m256i acc = _mm256_setzero_si256();
+        for (; i + 8 <= blockEnd; i += 8) {
+            acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), key));
+        }
+        alignas(32) unsigned lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        for (int lane = 0; lane < 8; ++ lane) total += lanes[lane];
+    }
+    return total + count_scalar(p + i, n - i, value);
+}
+
+MY_TARGET_AVX2 void add_avx2(int* dst, const int* src, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_add_epi32(a, b));
+    }
+    add_scalar(dst + i, src + i, n - i);
+}
+
+MY_TARGET_AVX2 void scale_avx2(int* p, size_t n, int factor) {
+    __m256i f = _mm256_set1_epi32(factor);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), _mm256_mullo_epi32(v, f));
+    }
+    scale_scalar(p + i, n - i, factor);
+}
+
+MY_TARGET_AVX2 void prefix_sum_avx2(int* p, size_t n) {
+    // 两个 128 位通道各自求前缀和，再把低通道的总和加到高通道
+    const __m256i last = _mm256_set1_epi32(7);
+    const __m256i lowLast = _mm256_set1_epi32(3);
+    __m256i carry = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+        __m256i cross = _mm256_blend_epi32(_mm256_setzero_si256(), _mm256_permutevar8x32_epi32(x, lowLast), 0xF0);
+        x = _mm256_add_epi32(_mm256_add_epi32(x, cross), carry);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), x);
+        carry = _mm256_permutevar8x32_epi32(x, last);
+    }
+    prefix_sum_scalar(p + i, n - i, _mm256_cvtsi256_si32(carry));
+}
+
+MY_TARGET_AVX2 size_t filter_avx2(const int* src, size_t n, int lo, int hi, int* out) {
+    const CompressTables& tables = compress_tables();
+    __m256i vlo = _mm256_set1_epi32(lo), vhi = _mm256_set1_epi32(hi);
+    size_t k = 0;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i reject = _mm256_or_si256(_mm256_cmpgt_epi32(vlo, x), _mm256_cmpgt_epi32(x, vhi));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(reject)) ^ 0xFF;
+        __m256i perm = _mm256_load_si256(reinterpret_cast<const __m256i*>(tables.avx2[mask]));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), _mm256_permutevar8x32_epi32(x, perm));
+        k += tables.popcount[mask];
+    }
+    return k + filter_scalar(src + i, n - i, lo, hi, out + k);
+}
+
+#endif // MY_INTVECTOR_X86_SIMD
+
+// ==========================================================
+// Dispatch
+// ==========================================================
+
+SimdLevel detect() {
+#if MY_INTVECTOR_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse4.1")) return SimdLevel::SSE41;
+#endif
+    return SimdLevel::Scalar;
+}
+
+SimdLevel& current() {
+    static SimdLevel level = detected_level();
+    return level;
+}
+
+} // namespace
+
+SimdLevel detected_level() {
+    static const SimdLevel level = detect();
+    return level;
+}
+
+SimdLevel active_level() {
+    return current();
+}
+
+void set_level(SimdLevel level) {
+    current() = level > detected_level() ? detected_level() : level;
+}
+
+#if MY_INTVECTOR_X86_SIMD
+#define MY_DISPATCH(name, ...)                                              \
+    switch (current()) {                                                    \
+        case SimdLevel::AVX2:  return name##_avx2(__VA_ARGS__);             \
+        case SimdLevel::SSE41: return name##_sse41(__VA_ARGS__);            \
+        default:               return name##_scalar(__VA_ARGS__);           \
+    }
+#else
+#define MY_DISPATCH(name, ...) return name##_scalar(__VA_ARGS__);
+#endif
+
+long long sum(const intVector& v) {
+    MY_DISPATCH(sum, v.begin(), v.size())
+}
+
+int min_value(const intVector& v) {
+    if (v.empty()) {
+        throw std::out_of_range("min_value of empty intVector");
+    }
+    MY_DISPATCH(min, v.begin(), v.size())
+}
+
+int max_value(const intVector& v) {
+    if (v.empty()) {
+        throw std::out_of_range("max_value of empty intVector");
+    }
+    MY_DISPATCH(max, v.begin(), v.size())
+}
+
+size_t find(const intVector& v, int value) {
+    MY_DISPATCH(find, v.begin(), v.size(), value)
+}
+
+size_t count(const intVector& v, int value) {
+    MY_DISPATCH(count, v.begin(), v.size(), value)
+}
+
+void add(intVector& dst, const intVector& src) {
+    if (dst.size() != src.size()) {
+        throw std::invalid_argument("intVector size mismatch");
+    }
+    MY_DISPATCH(add, dst.begin(), src.begin(), dst.size())
+}
+
+void scale(intVector& v, int factor) {
+    MY_DISPATCH(scale, v.begin(), v.size(), factor)
+}
+
+void prefix_sum(intVector& v) {
+#if MY_INTVECTOR_X86_SIMD
+    switch (current()) {
+        case SimdLevel::AVX2:  return prefix_sum_avx2(v.begin(), v.size());
+        case SimdLevel::SSE41: return prefix_sum_sse41(v.begin(), v.size());
+        default:               break;
+    }
+#endif
+    prefix_sum_scalar(v.begin(), v.size(), 0);
+}
+
+void filter(const intVector& src, int lo, int hi, intVector& out) {
+    // 压缩写入每次固定写满一个寄存器宽度，预留 8 个元素的余量
+    if (&out == &src) {
+        intVector temp;
+        filter(src, lo, hi, temp);
+        out.swap(temp);
+        return;
+    }
+    out.resize(src.size() + 8);
+    size_t kept = [&]() -> size_t {
+        MY_DISPATCH(filter, src.begin(), src.size(), lo, hi, out.begin())
+    }();
+    out.resize(kept);
+}
+
+#undef MY_DISPATCH
+
+} // namespace intKernels
@@ -0,0 +1,47 @@
+#ifndef MyINTVECTOR_SIMD_H
+#define MyINTVECTOR_SIMD_H
+
+#include <cstddef>
+#include "intVector.h"
+
+// ==========================================================
+// intKernels：intVector 的批量向量化算法
+// ==========================================================
+// 所有函数按运行时检测到的指令集分派到三套实现之一：
+//     AVX2   -> 一次处理 8 个 int
+//     SSE4.1 -> 一次处理 4 个 int
+//     Scalar -> 逐元素循环（非 x86 平台或 CPU 不支持时的后备实现）
+// SIMD 实现只在对应函数上开启 target 属性，整个程序不需要 -mavx2 编译，
+// 在老 CPU 上也能安全运行。
+//
+// 算术运算 (add / scale / prefix_sum) 按 32 位补码回绕，三套实现结果完全一致。
+
+namespace intKernels {
+
+enum class SimdLevel { Scalar, SSE41, AVX2 };
+
+// CPU 支持的最高级别
+SimdLevel detected_level();
+// 当前使用的级别（默认等于 detected_level()）
+SimdLevel active_level();
+// 强制使用较低级别（用于测试与基准对比），高于 detected_level() 时取 detected_level()
+void set_level(SimdLevel level);
+
+// 归约
+long long sum(const intVector& v);
+int min_value(const intVector& v);                  // 空向量抛 std::out_of_range
+int max_value(const intVector& v);                  // 空向量抛 std::out_of_range
+size_t find(const intVector& v, int value);         // 找不到返回 v.size()
+size_t count(const intVector& v, int value);
+
+// 逐元素变换（原地）
+void add(intVector& dst, const intVector& src);     // dst[i] += src[i]，长度不同抛 std::invalid_argument
+void scale(intVector& v, int factor);               // v[i] *= factor
+void prefix_sum(intVector& v);                      // v[i] = v[0] + ... + v[i]
+
+// 过滤：把 src 中满足 lo <= x <= hi 的元素按原顺序写入 out（覆盖 out 原有内容）
+void filter(const intVector& src, int lo, int hi, intVector& out);
+
+} // namespace intKernels
+
+#endif //MyINTVECTOR_SIMD_H
@@ -0,0 +1,349 @@
+#ifndef MY_BIT_VECTOR_H
+#define MY_BIT_VECTOR_H
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+#include <stdexcept>    // std::out_of_range, std::invalid_argument
+#include "myVector.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>     // __popcnt64, _BitScanForward64
+#endif
+
+// ==========================================================
+// myBitVector：按位压缩存储的 bool 序列
+// ==========================================================
+// myVector<bool> 每个元素占 1 字节；myBitVector 每个元素只占 1 bit，
+// 内存缩小为 1/8，并且按 64 位字批量处理：
+//
+//   bit:   63 ............ 1 0 | 127 ........... 65 64 | ...
+//   _words:      [0]           |          [1]          | ...
+//
+//     - count()        每个字一次 popcount
+//     - find_first()   跳过全 0 字，命中后用 ctz 定位
+//     - set_range()    首尾字用掩码，中间整字赋值
+//     - &= |= ^=       逐字运算
+//
+// 不变式：最后一个字中超出 size() 的高位恒为 0，count / find / 比较可以直接按字进行。
+// 字数组复用 myVector<uint64_t> 的扩容逻辑。
+
+class myBitVector {
+private:
+    using word_type = uint64_t;
+    static constexpr size_t word_bits = 64;
+
+    myVector<word_type> _words;     // 位存储
+    size_t _size;                   // 位数
+
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    // 单个位的代理引用（bool 无法直接取地址）
+    class reference {
+    public:
+        reference(word_type* word, word_type mask) : _word(word), _mask(mask) {}
+        operator bool() const noexcept { return (*_word & _mask) != 0; }
+        reference& operator=(bool value) noexcept {
+            if (value) *_word |= _mask;
+            else       *_word &= ~_mask;
+            return *this;
+        }
+        reference& operator=(const reference& other) noexcept { return *this = bool(other); }
+        void flip() noexcept { *_word ^= _mask; }
+
+    private:
+        word_type* _word;
+        word_type _mask;
+    };
+
+    /* ===== 构造 ===== */
+    myBitVector() : _size(0) {}
+    explicit myBitVector(size_t count, bool value = false);
+
+    /* ===== 容量相关 ===== */
+    size_t size() const noexcept { return _size; }
+    bool empty() const noexcept { return _size == 0; }
+    size_t capacity() const noexcept { return _words.capacity() * word_bits; }
+    void reserve(size_t bits) { _words.reserve(word_count(bits)); }
+    void resize(size_t newSize, bool value = false);
+    size_t memory_bytes() const noexcept { return _words.capacity() * sizeof(word_type); }
+
+    /* ===== 元素访问 ===== */
+    bool operator[](size_t index) const { return test(index); }
+    reference operator[](size_t index) { return reference(&_words[index / word_bits], bit_mask(index)); }
+    bool at(size_t index) const;
+    bool test(size_t index) const { return (_words[index / word_bits] & bit_mask(index)) != 0; }
+    const word_type* words() const noexcept { return _words.begin(); }
+    size_t word_size() const noexcept { return _words.size(); }
+
+    /* ===== 单个位修改 ===== */
+    void set(size_t index, bool value = true);
+    void reset(size_t index) { _words[index / word_bits] &= ~bit_mask(index); }
+    void flip(size_t index) { _words[index / word_bits] ^= bit_mask(index); }
+    void push_back(bool value);
+    void pop_back();
+    void clear() { _words.clear(); _size = 0; }
+
+    /* ===== 批量操作 ===== */
+    void set_range(size_t first, size_t last);     // [first, last) 置 1
+    void reset_range(size_t first, size_t last);   // [first, last) 置 0
+    void set_all() { set_range(0, _size); }
+    void reset_all() { reset_range(0, _size); }
+    size_t count() const noexcept;                 // 1 的个数
+    bool any() const noexcept;
+    bool none() const noexcept { return !any(); }
+    bool all() const noexcept { return count() == _size; }
+    size_t find_first() const noexcept;            // 第一个 1 的位置，没有则返回 npos
+    size_t find_next(size_t index) const noexcept; // index 之后第一个 1 的位置
+
+    /* ===== 位运算（两侧长度必须相同） ===== */
+    myBitVector& operator&=(const myBitVector& other);
+    myBitVector& operator|=(const myBitVector& other);
+    myBitVector& operator^=(const myBitVector& other);
+    void flip_all() noexcept;
+    bool operator==(const myBitVector& other) const noexcept;
+    bool operator!=(const myBitVector& other) const noexcept { return !(*this == other); }
+
+private:
+    /* ===== 内部工具 ===== */
+    static size_t word_count(size_t bits) noexcept { return (bits + word_bits - 1) / word_bits; }
+    static word_type bit_mask(size_t index) noexcept { return word_type(1) << (index % word_bits); }
+    static size_t popcount(word_type word) noexcept;
+    static size_t lowest_bit(word_type word) noexcept;
+    void fill_range(size_t first, size_t last, bool value);
+    void clear_tail() noexcept;
+    void check_same_size(const myBitVector& other) const;
+};
+
+inline myBitVector operator&(myBitVector lhs, const myBitVector& rhs) { return lhs &= rhs; }
+inline myBitVector operator|(myBitVector lhs, const myBitVector& rhs) { return lhs |= rhs; }
+inline myBitVector operator^(myBitVector lhs, const myBitVector& rhs) { return lhs ^= rhs; }
+
+
+// ==========================================================
+// Implementation - Constructors / Capacity
+// ==========================================================
+
+inline myBitVector::myBitVector(size_t count, bool value) : _size(0) {
+    resize(count, value);
+}
+
+inline void myBitVector::resize(size_t newSize, bool value) {
+    size_t oldSize = _size;
+    _words.resize(word_count(newSize), word_type(0));
+    _size = newSize;
+    if (newSize > oldSize) {
+        if (value) {
+            set_range(oldSize, newSize);
+        }
+    } else {
+        clear_tail();
+    }
+}
+
+// ==========================================================
+// Implementation - Access / Modifiers
+// ==========================================================
+
+inline bool myBitVector::at(size_t index) const {
+    if (index >= _size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return test(index);
+}
+
+inline void myBitVector::set(size_t index, bool value) {
+    if (value) _words[index / word_bits] |= bit_mask(index);
+    else       _words[index / word_bits] &= ~bit_mask(index);
+}
+
+inline void myBitVector::push_back(bool value) {
+    if (_size % word_bits == 0) {
+        _words.push_back(word_type(0));
+    }
+    if (value) {
+        _words[_size / word_bits] |= bit_mask(_size);
+    }
+    _size ++;
+}
+
+inline void myBitVector::pop_back() {
+    if (_size > 0) {
+        _size --;
+        reset(_size);
+        if (_size % word_bits == 0) {
+            _words.pop_back();
+        }
+    }
+}
+
+// ==========================================================
+// Implementation - Bulk Operations
+// ==========================================================
+
+inline void myBitVector::set_range(size_t first, size_t last) {
+    fill_range(first, last, true);
+}
+
+inline void myBitVector::reset_range(size_t first, size_t last) {
+    fill_range(first, last, false);
+}
+
+inline size_t myBitVector::count() const noexcept {
+    size_t total = 0;
+    const word_type* w = _words.begin();
+    for (size_t i = 0, n = _words.size(); i < n; ++ i) {
+        total += popcount(w[i]);
+    }
+    return total;
+}
+
+inline bool myBitVector::any() const noexcept {
+    for (size_t i = 0, n = _words.size(); i < n; ++ i) {
+        if (_words[i] != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline size_t myBitVector::find_first() const noexcept {
+    for (size_t i = 0, n = _words.size(); i < n; ++ i) {
+        if (_words[i] != 0) {
+            return i * word_bits + lowest_bit(_words[i]);
+        }
+    }
+    return npos;
+}
+
+inline size_t myBitVector::find_next(size_t index) const noexcept {
+    size_t start = index + 1;
+    if (start >= _size) {
+        return npos;
+    }
+    size_t i = start / word_bits;
+    // 当前字先屏蔽掉 start 之前的位
+    word_type word = _words[i] & (~word_type(0) << (start % word_bits));
+    for (size_t n = _words.size();;) {
+        if (word != 0) {
+            return i * word_bits + lowest_bit(word);
+        }
+        if (++ i == n) {
+            return npos;
+        }
+        word = _words[i];
+    }
+}
+
+inline myBitVector& myBitVector::operator&=(const myBitVector& other) {
+    check_same_size(other);
+    for (size_t i = 0, n = _words.size(); i < n; ++ i) _words[i] &= other._words[i];
+    return *this;
+}
+
+inline myBitVector& myBitVector::operator|=(const myBitVector& other) {
+    check_same_size(other);
+    for (size_t i = 0, n = _words.size(); i < n; ++ i) _words[i] |= other._words[i];
+    return *this;
+}
+
+inline myBitVector& myBitVector::operator^=(const myBitVector& other) {
+    check_same_size(other);
+    for (size_t i = 0, n = _words.size(); i < n; ++ i) _words[i] ^= other._words[i];
+    return *this;
+}
+
+inline void myBitVector::flip_all() noexcept {
+    for (size_t i = 0, n = _words.size(); i < n; ++ i) _words[i] = ~_words[i];
+    clear_tail();
+}
+
+inline bool myBitVector::operator==(const myBitVector& other) const noexcept {
+    if (_size != other._size) {
+        return false;
+    }
+    for (size_t i = 0, n = _words.size(); i < n; ++ i) {
+        if (_words[i] != other._words[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ==========================================================
+// Implementation - Internal Tools
+// ==========================================================
+
+inline size_t myBitVector::popcount(word_type word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_popcountll(word));
+#elif defined(_MSC_VER) && defined(_WIN64)
+    return static_cast<size_t>(__popcnt64(word));
+#else
+    size_t n = 0;
+    while (word) {
+        word &= word - 1;
+        n ++;
+    }
+    return n;
+#endif
+}
+
+inline size_t myBitVector::lowest_bit(word_type word) noexcept {
+    // 最低有效位的位置（word != 0）
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_ctzll(word));
+#elif defined(_MSC_VER) && defined(_WIN64)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return index;
+#else
+    size_t bit = 0;
+    while ((word & 1) == 0) {
+        word >>= 1;
+        bit ++;
+    }
+    return bit;
+#endif
+}
+
+inline void myBitVector::fill_range(size_t first, size_t last, bool value) {
+    if (first > last || last > _size) {
+        throw std::out_of_range("Range out of range");
+    }
+    if (first == last) {
+        return;
+    }
+    size_t firstWord = first / word_bits;
+    size_t lastWord = (last - 1) / word_bits;
+    word_type headMask = ~word_type(0) << (first % word_bits);
+    word_type tailMask = ~word_type(0) >> (word_bits - 1 - (last - 1) % word_bits);
+    word_type fill = value ? ~word_type(0) : word_type(0);
+
+    if (firstWord == lastWord) {
+        word_type mask = headMask & tailMask;
+        _words[firstWord] = (_words[firstWord] & ~mask) | (fill & mask);
+        return;
+    }
+    _words[firstWord] = (_words[firstWord] & ~headMask) | (fill & headMask);
+    for (size_t i = firstWord + 1; i < lastWord; ++ i) {
+        _words[i] = fill;
+    }
+    _words[lastWord] = (_words[lastWord] & ~tailMask) | (fill & tailMask);
+}
+
+// 维护不变式：最后一个字中超出 _size 的位清零
+inline void myBitVector::clear_tail() noexcept {
+    size_t used = _size % word_bits;
+    if (used != 0) {
+        _words[_words.size() - 1] &= ~word_type(0) >> (word_bits - used);
+    }
+}
+
+inline void myBitVector::check_same_size(const myBitVector& other) const {
+    if (_size != other._size) {
+        throw std::invalid_argument("myBitVector size mismatch");
+    }
+}
+
+#endif // MY_BIT_VECTOR_H
@@ -0,0 +1,332 @@
+#ifndef MY_COMPRESSED_INT_VECTOR_H
+#define MY_COMPRESSED_INT_VECTOR_H
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t, uint8_t
+#include <stdexcept>    // std::out_of_range
+#include "myVector.h"
+#include "intVector/intVector.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>  // SSE2：x86-64 的基线指令集，无需运行时分派
+#define MY_COMPRESSED_SSE2 1
+#else
+#define MY_COMPRESSED_SSE2 0
+#endif
+
+// ==========================================================
+// myCompressedIntVector：分块差分 + 位压缩的只读为主整数序列
+// ==========================================================
+// 有序 ID 列表相邻元素之差通常很小，每个值却占 4 字节。本容器把序列按 128 个一块编码：
+//
+//   块 k:  d[i] = v[i] - v[i-1] (d[0] = 0)，取块内最大差值的位宽 b，
+//          128 个差值各占 b bit，共 b * 16 字节
+//
+//   _skips[k] = { 块首值 base, 压缩数据偏移 offset, 位宽 bits }
+//
+// 压缩数据采用 4 路交错布局（第 i 个差值属于第 i % 4 路），解码时一个 128 位寄存器
+// 同时处理 4 路：移位、掩码、寄存器内前缀和恢复原值，全程无分支。
+// 差值按 32 位无符号回绕计算，任意序列都能无损编码，但只有非降序序列才能压得小，
+// lower_bound 也要求序列非降序。
+//
+// 访问：
+//     - operator[] / at：定位块 O(1)，块内累加差值 O(128)
+//     - lower_bound：在块首值上二分 O(log n)，再解码命中的那一块
+//     - decode_block：整块解码到调用者的缓冲区，顺序扫描用这个
+// 追加：push_back 先写入未压缩的尾块，攒满 128 个再压缩。
+
+class myCompressedIntVector {
+public:
+    static constexpr size_t block_size = 128;
+
+private:
+    struct SkipEntry {
+        uint32_t base;      // 块首值
+        uint32_t offset;    // 在 _packed 中的起始下标（uint32_t 为单位）
+        uint8_t  bits;      // 差值位宽
+    };
+
+    myVector<uint32_t>  _packed;    // 所有满块的压缩数据
+    myVector<SkipEntry> _skips;     // 每个满块一项
+    myVector<uint32_t>  _tail;      // 尚未满 128 个的尾块（未压缩）
+
+public:
+    /* ===== 构造 ===== */
+    myCompressedIntVector() = default;
+    myCompressedIntVector(const uint32_t* values, size_t count) { append(values, count); }
+    explicit myCompressedIntVector(const intVector& values);
+    template <typename Alloc, typename GrowthPolicy>
+    explicit myCompressedIntVector(const myVector<uint32_t, Alloc, GrowthPolicy>& values)
+        : myCompressedIntVector(values.begin(), values.size()) {}
+
+    /* ===== 容量相关 ===== */
+    size_t size() const noexcept { return _skips.size() * block_size + _tail.size(); }
+    bool empty() const noexcept { return size() == 0; }
+    // 块数（含未满的尾块）
+    size_t block_count() const noexcept { return _skips.size() + (_tail.empty() ? 0 : 1); }
+    size_t memory_bytes() const noexcept;
+
+    /* ===== 元素访问 ===== */
+    uint32_t operator[](size_t index) const;
+    uint32_t at(size_t index) const;
+    // 第一个 >= value 的下标，没有则返回 size()（要求序列非降序）
+    size_t lower_bound(uint32_t value) const;
+    bool contains(uint32_t value) const;
+
+    /* ===== 解码 ===== */
+    // 把第 block 块解码到 out（至少 block_size 个空间），返回该块元素个数
+    size_t decode_block(size_t block, uint32_t* out) const;
+    // 解码全部元素到 out（至少 size() 个空间）
+    void decode(uint32_t* out) const;
+
+    /* ===== 修改器 ===== */
+    void push_back(uint32_t value);
+    void append(const uint32_t* values, size_t count);
+    void clear();
+
+private:
+    /* ===== 内部工具 ===== */
+    void seal_tail();
+    static uint8_t bit_width(uint32_t value) noexcept;
+    static void pack(const uint32_t* deltas, uint8_t bits, uint32_t* out) noexcept;
+    static void unpack(const uint32_t* in, uint8_t bits, uint32_t base, uint32_t* out) noexcept;
+    static uint32_t delta_at(const uint32_t* in, uint8_t bits, size_t i) noexcept;
+};
+
+
+// ==========================================================
+// Implementation - Constructors / Capacity
+// ==========================================================
+
+inline myCompressedIntVector::myCompressedIntVector(const intVector& values) {
+    // intVector 存 int；按位重解释为 uint32_t（负数保持补码）
+    for (size_t i = 0; i < values.size(); ++ i) {
+        push_back(static_cast<uint32_t>(values[i]));
+    }
+}
+
+inline size_t myCompressedIntVector::memory_bytes() const noexcept {
+    return _packed.capacity() * sizeof(uint32_t) + _skips.capacity() * sizeof(SkipEntry)
+         + _tail.capacity() * sizeof(uint32_t);
+}
+
+// ==========================================================
+// Implementation - Access
+// ==========================================================
+
+inline uint32_t myCompressedIntVector::operator[](size_t index) const {
+    size_t block = index / block_size;
+    if (block == _skips.size()) {
+        return _tail[index % block_size];
+    }
+    const SkipEntry& skip = _skips[block];
+    const uint32_t* in = _packed.begin() + skip.offset;
+    uint32_t value = skip.base;
+    for (size_t i = 1, k = index % block_size; i <= k; ++ i) {
+        value += delta_at(in, skip.bits, i);
+    }
+    return value;
+}
+
+inline uint32_t myCompressedIntVector::at(size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return (*this)[index];
+}
+
+inline size_t myCompressedIntVector::lower_bound(uint32_t value) const {
+    // 找最后一个块首值 < value 的满块，答案落在该块内或下一块开头
+    size_t lo = 0, hi = _skips.size();
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (_skips[mid].base < value) lo = mid + 1;
+        else                          hi = mid;
+    }
+    // lo 为第一个块首值 >= value 的满块；候选区间是第 lo - 1 块
+    uint32_t buffer[block_size];
+    if (lo > 0) {
+        size_t block = lo - 1;
+        size_t n = decode_block(block, buffer);
+        for (size_t i = 0; i < n; ++ i) {
+            if (buffer[i] >= value) return block * block_size + i;
+        }
+        if (lo < _skips.size()) {
+            return lo * block_size;
+        }
+    } else if (!_skips.empty()) {
+        return 0;
+    }
+    // 落在尾块
+    for (size_t i = 0; i < _tail.size(); ++ i) {
+        if (_tail[i] >= value) return _skips.size() * block_size + i;
+    }
+    return size();
+}
+
+inline bool myCompressedIntVector::contains(uint32_t value) const {
+    size_t index = lower_bound(value);
+    return index < size() && (*this)[index] == value;
+}
+
+// ==========================================================
+// Implementation - Decode
+// ==========================================================
+
+inline size_t myCompressedIntVector::decode_block(size_t block, uint32_t* out) const {
+    if (block == _skips.size()) {
+        for (size_t i = 0; i < _tail.size(); ++ i) out[i] = _tail[i];
+        return _tail.size();
+    }
+    if (block > _skips.size()) {
+        throw std::out_of_range("Block out of range");
+    }
+    const SkipEntry& skip = _skips[block];
+    unpack(_packed.begin() + skip.offset, skip.bits, skip.base, out);
+    return block_size;
+}
+
+inline void myCompressedIntVector::decode(uint32_t* out) const {
+    for (size_t b = 0, n = block_count(); b < n; ++ b) {
+        out += decode_block(b, out);
+    }
+}
+
+// ==========================================================
+// Implementation - Modifiers
+// ==========================================================
+
+inline void myCompressedIntVector::push_back(uint32_t value) {
+    _tail.push_back(value);
+    if (_tail.size() == block_size) {
+        try {
+            seal_tail();
+        } catch (...) {
+            _tail.pop_back();
+            throw;
+        }
+    }
+}
+
+inline void myCompressedIntVector::append(const uint32_t* values, size_t count) {
+    for (size_t i = 0; i < count; ++ i) {
+        push_back(values[i]);
+    }
+}
+
+inline void myCompressedIntVector::clear() {
+    _packed.clear();
+    _skips.clear();
+    _tail.clear();
+}
+
+// ==========================================================
+// Implementation - Internal Tools
+// ==========================================================
+
+// 把满 128 个的尾块压缩进 _packed
+inline void myCompressedIntVector::seal_tail() {
+    uint32_t deltas[block_size];
+    uint32_t maxDelta = 0;
+    deltas[0] = 0;
+    for (size_t i = 1; i < block_size; ++ i) {
+        deltas[i] = _tail[i] - _tail[i - 1];
+        maxDelta |= deltas[i];
+    }
+    uint8_t bits = bit_width(maxDelta);
+    size_t offset = _packed.size();
+    _skips.push_back(SkipEntry{ _tail[0], static_cast<uint32_t>(offset), bits });
+    try {
+        _packed.resize(offset + bits * 4);
+    } catch (...) {
+        _skips.pop_back();  // 保持尾块不变，强异常安全
+        throw;
+    }
+    pack(deltas, bits, _packed.begin() + offset);
+    _tail.clear();
+}
+
+inline uint8_t myCompressedIntVector::bit_width(uint32_t value) noexcept {
+    uint8_t bits = 0;
+    while (value != 0) {
+        value >>= 1;
+        bits ++;
+    }
+    return bits;
+}
+
+// 4 路交错：第 i 个差值属于第 i % 4 路、路内第 i / 4 个；
+// 路内第 j 个值占该路位流的 [j * bits, (j + 1) * bits)，该路第 w 个字存于 out[w * 4 + lane]
+inline void myCompressedIntVector::pack(const uint32_t* deltas, uint8_t bits, uint32_t* out) noexcept {
+    for (size_t w = 0; w < size_t(bits) * 4; ++ w) {
+        out[w] = 0;
+    }
+    if (bits == 0) {
+        return;
+    }
+    for (size_t i = 0; i < block_size; ++ i) {
+        size_t lane = i % 4;
+        size_t bit = (i / 4) * bits;
+        size_t w = bit / 32, s = bit % 32;
+        out[w * 4 + lane] |= deltas[i] << s;
+        if (s + bits > 32) {
+            out[(w + 1) * 4 + lane] |= deltas[i] >> (32 - s);
+        }
+    }
+}
+
+inline uint32_t myCompressedIntVector::delta_at(const uint32_t* in, uint8_t bits, size_t i) noexcept {
+    if (bits == 0) {
+        return 0;
+    }
+    size_t lane = i % 4;
+    size_t bit = (i / 4) * bits;
+    size_t w = bit / 32, s = bit % 32;
+    uint32_t mask = bits == 32 ? ~uint32_t(0) : (uint32_t(1) << bits) - 1;
+    uint32_t value = in[w * 4 + lane] >> s;
+    if (s + bits > 32) {
+        value |= in[(w + 1) * 4 + lane] << (32 - s);
+    }
+    return value & mask;
+}
+
+inline void myCompressedIntVector::unpack(const uint32_t* in, uint8_t bits, uint32_t base, uint32_t* out) noexcept {
+#if MY_COMPRESSED_SSE2
+    // 每轮解出 4 路各一个差值 (d[4j .. 4j+3])，寄存器内前缀和后加上前一轮的末值
+    const __m128i mask = _mm_set1_epi32(bits == 32 ? -1 : static_cast<int>((uint32_t(1) << bits) - 1));
+    __m128i carry = _mm_set1_epi32(static_cast<int>(base));
+    size_t w = 0, s = 0;
+    for (size_t j = 0; j < block_size / 4; ++ j) {
+        __m128i x = _mm_setzero_si128();
+        if (bits != 0) {
+            __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + w * 4));
+            x = _mm_srl_epi32(cur, _mm_cvtsi32_si128(static_cast<int>(s)));
+            if (s + bits > 32) {
+                __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + (w + 1) * 4));
+                x = _mm_or_si128(x, _mm_sll_epi32(next, _mm_cvtsi32_si128(static_cast<int>(32 - s))));
+            }
+            x = _mm_and_si128(x, mask);
+            s += bits;
+            if (s >= 32) {
+                s -= 32;
+                w ++;
+            }
+        }
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, carry);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + j * 4), x);
+        carry = _mm_shuffle_epi32(x, 0xFF);
+    }
+#else
+    uint32_t value = base;
+    for (size_t i = 0; i < block_size; ++ i) {
+        value += delta_at(in, bits, i);
+        out[i] = value;
+    }
+#endif
+}
+
+#undef MY_COMPRESSED_SSE2
+
+#endif // MY_COMPRESSED_INT_VECTOR_H
@@ -0,0 +1,413 @@
+#ifndef MY_CONCURRENT_VECTOR_H
+#define MY_CONCURRENT_VECTOR_H
+
+#include <cstddef>      // size_t, ptrdiff_t
+#include <atomic>       // std::atomic
+#include <mutex>        // std::mutex
+#include <utility>      // std::move, std::forward
+#include <stdexcept>    // std::out_of_range, std::length_error
+#include <memory>       // std::allocator, std::allocator_traits
+#include <iterator>     // std::random_access_iterator_tag
+#include <type_traits>  // std::is_nothrow_move_constructible
+
+// ==========================================================
+// myConcurrentVector：多生产者并发追加、读者无锁遍历的 vector
+// ==========================================================
+// 用互斥锁包装 myVector::push_back 会把所有生产者串行化，而且 reallocate() 搬迁元素时
+// 读者手里的指针全部失效。myConcurrentVector 与 myStableVector 采用相同的几何分段布局
+// （第 k 段容量 B * 2^k），元素一旦写入就不再移动：
+//
+//     1. 领取槽位：_reserved.fetch_add(1)，生产者之间只竞争这一个原子计数器
+//     2. 确保所在段已分配：段指针为空时加锁、双重检查后分配（每段只发生一次）
+//     3. 在槽位上构造元素，然后置位该槽位的 ready 标志
+//     4. 推进发布大小：从 _size 开始，沿着连续的 ready 槽位把 _size 向前推
+//        —— 任何生产者都可以替别人推进，慢的生产者不会让快的生产者空等
+//
+// 读者只访问 [0, size())：size() 以 acquire 读取，此前发布的元素都已完整构造，
+// 遍历无需加锁，且与正在进行的 push_back 互不干扰。
+//
+// 限制：
+//     - 只追加：不支持 pop_back / erase；clear 与析构不能与其它操作并发
+//     - 槽位领取后不能再失败：元素若可能在构造时抛异常，先在栈上构造再 nothrow 移动进槽位，
+//       因此要求 T 可 nothrow 移动构造
+//     - 分配新段失败时 push_back 抛出 std::bad_alloc，已领取的槽位成为空洞，
+//       其后的元素不再被发布；需要避免时可预先 reserve
+
+template <typename T, typename Alloc = std::allocator<T>, size_t FirstBits = 6>
+class myConcurrentVector {
+    static_assert(FirstBits < 32, "first segment too large");
+    static_assert(std::is_nothrow_move_constructible_v<T>, "myConcurrentVector requires a nothrow move constructor");
+private:
+    using traits = std::allocator_traits<Alloc>;
+    using flag_type = std::atomic<bool>;
+    using flag_alloc = typename traits::template rebind_alloc<flag_type>;
+    using flag_traits = std::allocator_traits<flag_alloc>;
+
+    static constexpr size_t first_size = size_t(1) << FirstBits;
+    static constexpr size_t max_segments = sizeof(size_t) * 8 - FirstBits;
+
+    std::atomic<T*>         _segments[max_segments];    // 各段起始地址（未分配为 nullptr）
+    std::atomic<flag_type*> _ready[max_segments];       // 各段每个槽位的 "已构造" 标志
+    alignas(64) std::atomic<size_t> _reserved;          // 已领取的槽位数
+    alignas(64) std::atomic<size_t> _size;              // 已发布的元素个数
+    std::mutex _growMutex;                              // 仅在分配新段时使用
+    Alloc allocator;
+    flag_alloc flagAllocator;
+
+public:
+    /* ===== 迭代器 ===== */
+    // 只读随机访问迭代器；end() 取构造时刻的 size() 快照
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() : _owner(nullptr), _index(0) {}
+        const_iterator(const myConcurrentVector* owner, size_t index) : _owner(owner), _index(index) {}
+
+        reference operator*() const { return (*_owner)[_index]; }
+        pointer operator->() const { return &(*_owner)[_index]; }
+        reference operator[](difference_type n) const { return (*_owner)[_index + n]; }
+        const_iterator& operator++() { ++ _index; return *this; }
+        const_iterator operator++(int) { const_iterator temp = *this; ++ _index; return temp; }
+        const_iterator& operator--() { -- _index; return *this; }
+        const_iterator operator--(int) { const_iterator temp = *this; -- _index; return temp; }
+        const_iterator& operator+=(difference_type n) { _index += n; return *this; }
+        const_iterator& operator-=(difference_type n) { _index -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return const_iterator(_owner, _index + n); }
+        const_iterator operator-(difference_type n) const { return const_iterator(_owner, _index - n); }
+        difference_type operator-(const const_iterator& other) const { return difference_type(_index) - difference_type(other._index); }
+        bool operator==(const const_iterator& other) const { return _index == other._index; }
+        bool operator!=(const const_iterator& other) const { return _index != other._index; }
+        bool operator<(const const_iterator& other) const { return _index < other._index; }
+
+    private:
+        const myConcurrentVector* _owner;
+        size_t _index;
+    };
+    using iterator = const_iterator;
+
+    /* ===== 构造 / 析构 ===== */
+    myConcurrentVector();
+    explicit myConcurrentVector(const Alloc& alloc);
+    ~myConcurrentVector();
+    myConcurrentVector(const myConcurrentVector&) = delete;
+    myConcurrentVector& operator=(const myConcurrentVector&) = delete;
+
+    /* ===== 容量相关 ===== */
+    size_t size() const noexcept;
+    bool empty() const noexcept;
+    size_t capacity() const noexcept;
+    void reserve(size_t newCapacity);
+
+    /* ===== 元素访问 ===== */
+    // 下标须小于某次 size() 的返回值
+    const T& operator[](size_t index) const;
+    T& operator[](size_t index);
+    const T& at(size_t index) const;
+    T& at(size_t index);
+
+    /* ===== 迭代器 ===== */
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    /* ===== 修改器（线程安全） ===== */
+    // 返回新元素的下标；返回时元素已构造，但可能因更早的槽位尚未完成而暂未发布
+    size_t push_back(const T& value);
+    size_t push_back(T&& value);
+    template <typename ... Args>
+    size_t emplace_back(Args&& ... args);
+
+    /* ===== 修改器（不可与其它操作并发） ===== */
+    void clear();
+
+private:
+    /* ===== 内部工具 ===== */
+    static size_t high_bit(size_t x) noexcept;
+    static size_t segment_size(size_t k) noexcept;
+    static void locate(size_t index, size_t& k, size_t& offset) noexcept;
+    T* slot(size_t index) const noexcept;
+    void ensure_segment(size_t k);
+    void publish() noexcept;
+    template <typename ... Args>
+    size_t place(Args&& ... args);
+    void release() noexcept;
+};
+
+
+// ==========================================================
+// Implementation - Constructors / Destructor
+// ==========================================================
+
+template <typename T, typename Alloc, size_t FirstBits>
+myConcurrentVector<T, Alloc, FirstBits>::myConcurrentVector() : myConcurrentVector(Alloc()) {}
+
+template <typename T, typename Alloc, size_t FirstBits>
+myConcurrentVector<T, Alloc, FirstBits>::myConcurrentVector(const Alloc& alloc)
+    : _reserved(0), _size(0), allocator(alloc), flagAllocator(alloc) {
+        for (size_t k = 0; k < max_segments; k ++) {
+            _segments[k].store(nullptr, std::memory_order_relaxed);
+            _ready[k].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+template <typename T, typename Alloc, size_t FirstBits>
+myConcurrentVector<T, Alloc, FirstBits>::~myConcurrentVector() {
+    release();
+}
+
+// ==========================================================
+// Implementation - Capacity
+// ==========================================================
+
+template <typename T, typename Alloc, size_t FirstBits>
+size_t myConcurrentVector<T, Alloc, FirstBits>::size() const noexcept {
+    return _size.load(std::memory_order_acquire);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+bool myConcurrentVector<T, Alloc, FirstBits>::empty() const noexcept {
+    return size() == 0;
+}
+
+// 已分配段的总容量（段按顺序分配时为 B * (2^k - 1)）
+template <typename T, typename Alloc, size_t FirstBits>
+size_t myConcurrentVector<T, Alloc, FirstBits>::capacity() const noexcept {
+    size_t total = 0;
+    for (size_t k = 0; k < max_segments && _segments[k].load(std::memory_order_acquire) != nullptr; k ++) {
+        total += segment_size(k);
+    }
+    return total;
+}
+
+// 预先分配覆盖 [0, newCapacity) 的所有段；可与 push_back 并发
+template <typename T, typename Alloc, size_t FirstBits>
+void myConcurrentVector<T, Alloc, FirstBits>::reserve(size_t newCapacity) {
+    if (newCapacity == 0) {
+        return;
+    }
+    size_t last, offset;
+    locate(newCapacity - 1, last, offset);
+    for (size_t k = 0; k <= last; k ++) {
+        ensure_segment(k);
+    }
+}
+
+// ==========================================================
+// Implementation - Element Access
+// ==========================================================
+
+template <typename T, typename Alloc, size_t FirstBits>
+const T& myConcurrentVector<T, Alloc, FirstBits>::operator[](size_t index) const {
+    return *slot(index);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+T& myConcurrentVector<T, Alloc, FirstBits>::operator[](size_t index) {
+    return *slot(index);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+const T& myConcurrentVector<T, Alloc, FirstBits>::at(size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return *slot(index);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+T& myConcurrentVector<T, Alloc, FirstBits>::at(size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return *slot(index);
+}
+
+// ==========================================================
+// Implementation - Iterators
+// ==========================================================
+
+template <typename T, typename Alloc, size_t FirstBits>
+typename myConcurrentVector<T, Alloc, FirstBits>::const_iterator myConcurrentVector<T, Alloc, FirstBits>::begin() const noexcept {
+    return const_iterator(this, 0);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+typename myConcurrentVector<T, Alloc, FirstBits>::const_iterator myConcurrentVector<T, Alloc, FirstBits>::end() const noexcept {
+    return const_iterator(this, size());
+}
+
+// ==========================================================
+// Implementation - Modifiers
+// ==========================================================
+
+template <typename T, typename Alloc, size_t FirstBits>
+size_t myConcurrentVector<T, Alloc, FirstBits>::push_back(const T& value) {
+    return emplace_back(value);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+size_t myConcurrentVector<T, Alloc, FirstBits>::push_back(T&& value) {
+    return emplace_back(std::move(value));
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+template <typename ... Args>
+size_t myConcurrentVector<T, Alloc, FirstBits>::emplace_back(Args&& ... args) {
+    if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+        return place(std::forward<Args>(args)...);
+    } else {
+        // 可能抛异常的构造在领取槽位之前完成，领取之后只做 nothrow 移动
+        T temp(std::forward<Args>(args)...);
+        return place(std::move(temp));
+    }
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+void myConcurrentVector<T, Alloc, FirstBits>::clear() {
+    size_t reserved = _reserved.load(std::memory_order_acquire);
+    for (size_t i = 0; i < reserved; i ++) {
+        size_t k, offset;
+        locate(i, k, offset);
+        flag_type* ready = _ready[k].load(std::memory_order_relaxed);
+        if (ready != nullptr && ready[offset].load(std::memory_order_relaxed)) {
+            traits::destroy(allocator, _segments[k].load(std::memory_order_relaxed) + offset);
+            ready[offset].store(false, std::memory_order_relaxed);
+        }
+    }
+    _reserved.store(0, std::memory_order_relaxed);
+    _size.store(0, std::memory_order_release);
+}
+
+// ==========================================================
+// Implementation - Internal Tools
+// ==========================================================
+
+template <typename T, typename Alloc, size_t FirstBits>
+size_t myConcurrentVector<T, Alloc, FirstBits>::high_bit(size_t x) noexcept {
+    // 最高有效位的位置（x > 0）
+#if defined(__GNUC__) || defined(__clang__)
+    return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(static_cast<unsigned long long>(x));
+#else
+    size_t bit = 0;
+    while (x >>= 1) {
+        bit ++;
+    }
+    return bit;
+#endif
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+size_t myConcurrentVector<T, Alloc, FirstBits>::segment_size(size_t k) noexcept {
+    return first_size << k;
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+void myConcurrentVector<T, Alloc, FirstBits>::locate(size_t index, size_t& k, size_t& offset) noexcept {
+    size_t j = index + first_size;
+    size_t h = high_bit(j);
+    k = h - FirstBits;
+    offset = j - (size_t(1) << h);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+T* myConcurrentVector<T, Alloc, FirstBits>::slot(size_t index) const noexcept {
+    size_t k, offset;
+    locate(index, k, offset);
+    return _segments[k].load(std::memory_order_acquire) + offset;
+}
+
+// 双重检查：段已存在时只有一次 acquire 读取；否则加锁分配。
+// ready 标志先于段指针发布，拿到段指针的线程一定能看到标志数组；
+// 标志数组指针以 seq_cst 发布，使 publish 中的 seq_cst 读取也位于同一全序中（见 publish）
+template <typename T, typename Alloc, size_t FirstBits>
+void myConcurrentVector<T, Alloc, FirstBits>::ensure_segment(size_t k) {
+    if (k >= max_segments) {
+        throw std::length_error("myConcurrentVector: too many elements");
+    }
+    if (_segments[k].load(std::memory_order_acquire) != nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_growMutex);
+    if (_segments[k].load(std::memory_order_relaxed) != nullptr) {
+        return;
+    }
+    size_t n = segment_size(k);
+    flag_type* ready = flag_traits::allocate(flagAllocator, n);
+    for (size_t i = 0; i < n; i ++) {
+        flag_traits::construct(flagAllocator, ready + i, false);
+    }
+    T* data;
+    try {
+        data = traits::allocate(allocator, n);
+    } catch (...) {
+        flag_traits::deallocate(flagAllocator, ready, n);
+        throw;
+    }
+    _ready[k].store(ready, std::memory_order_seq_cst);
+    _segments[k].store(data, std::memory_order_release);
+}
+
+// 领取槽位 -> 构造 -> 置位 ready -> 推进发布大小；args 的构造必须不抛异常
+template <typename T, typename Alloc, size_t FirstBits>
+template <typename ... Args>
+size_t myConcurrentVector<T, Alloc, FirstBits>::place(Args&& ... args) {
+    size_t index = _reserved.fetch_add(1, std::memory_order_relaxed);
+    size_t k, offset;
+    locate(index, k, offset);
+    ensure_segment(k);
+    traits::construct(allocator, _segments[k].load(std::memory_order_acquire) + offset, std::forward<Args>(args)...);
+    // seq_cst：与 publish 中对 _size 的读取构成 "写标志-读大小" / "写大小-读标志" 的全序，
+    // 保证最后完成的那个生产者一定能看到所有已就绪的槽位
+    _ready[k].load(std::memory_order_relaxed)[offset].store(true, std::memory_order_seq_cst);
+    publish();
+    return index;
+}
+
+// 沿连续的已就绪槽位推进 _size，遇到未就绪的槽位或尚未分配的段即停止；
+// CAS 失败说明别的线程已推进，从新值继续。
+// 不以 _reserved 为扫描上界：领取槽位的 fetch_add 不在 seq_cst 全序中，读到旧值会让最后完成的生产者提前停下。
+// 标志的写入与读取、标志数组指针的发布与读取都是 seq_cst，两个生产者中后置位标志的一方一定能看到先置位的一方
+template <typename T, typename Alloc, size_t FirstBits>
+void myConcurrentVector<T, Alloc, FirstBits>::publish() noexcept {
+    size_t current = _size.load(std::memory_order_seq_cst);
+    for (;;) {
+        size_t next = current;
+        for (;;) {
+            size_t k, offset;
+            locate(next, k, offset);
+            flag_type* ready = _ready[k].load(std::memory_order_seq_cst);
+            if (ready == nullptr || !ready[offset].load(std::memory_order_seq_cst)) {
+                break;
+            }
+            next ++;
+        }
+        if (next == current) {
+            return;
+        }
+        if (_size.compare_exchange_weak(current, next, std::memory_order_seq_cst)) {
+            current = next;
+        }
+    }
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+void myConcurrentVector<T, Alloc, FirstBits>::release() noexcept {
+    clear();
+    for (size_t k = 0; k < max_segments; k ++) {
+        T* data = _segments[k].load(std::memory_order_relaxed);
+        if (data == nullptr) {
+            continue;
+        }
+        size_t n = segment_size(k);
+        traits::deallocate(allocator, data, n);
+        flag_traits::deallocate(flagAllocator, _ready[k].load(std::memory_order_relaxed), n);
+        _segments[k].store(nullptr, std::memory_order_relaxed);
+        _ready[k].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+#endif // MY_CONCURRENT_VECTOR_H
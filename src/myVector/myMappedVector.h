@@ -0,0 +1,401 @@
+#ifndef MY_MAPPED_VECTOR_H
+#define MY_MAPPED_VECTOR_H
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "myMappedVector requires POSIX mmap"
+#endif
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t, uint64_t
+#include <cstring>      // std::memcmp, std::memcpy, std::memset
+#include <cerrno>       // errno
+#include <string>
+#include <stdexcept>    // std::out_of_range, std::runtime_error
+#include <system_error> // std::system_error
+#include <type_traits>  // std::is_trivially_copyable
+#include <utility>      // std::exchange
+#include <fcntl.h>      // open
+#include <unistd.h>     // close, ftruncate
+#include <sys/mman.h>   // mmap, mremap, munmap, msync
+#include <sys/stat.h>   // fstat
+#include "growthPolicy.h"
+
+// ==========================================================
+// myMappedVector：文件映射的持久化 vector
+// ==========================================================
+// 元素直接存放在 mmap 映射的文件中，"保存" 无需遍历写盘，"加载" 无需解析与 push_back：
+// 重新打开文件只需校验文件头并 mmap，重启开销为 O(1)。
+//
+// 文件布局：
+// ┌──────────────────── Header (64B) ────────────────────┬─────────────────────────┐
+// │ magic | version | sizeof(T) | alignof(T) | size | cap │ T[0] T[1] ... T[cap-1]  │
+// └──────────────────────────────────────────────────────┴─────────────────────────┘
+//
+// 扩容：ftruncate 扩大文件，再用 mremap (Linux) 或 munmap + mmap 重新映射，
+//      内核只调整页表，已写入的数据无需拷贝。
+//      新容量固定按 myGrowthDoubling（growthPolicy.h）计算，不提供 GrowthPolicy 模板参数。
+// flush()：msync 把脏页同步到磁盘；不调用时由内核择机回写。
+//
+// 限制：
+//     - 仅支持 trivially copyable 的 T（按字节持久化，不保存指针）。
+//     - 文件头记录 sizeof(T) / alignof(T) / 版本号，打开时不匹配则抛出 std::runtime_error。
+//     - 只能移动，不能拷贝（一个文件只对应一个映射）。
+
+template <typename T>
+class myMappedVector {
+    static_assert(std::is_trivially_copyable_v<T>, "myMappedVector requires a trivially copyable type");
+    static_assert(alignof(T) <= 64, "element alignment exceeds header size");
+private:
+    struct Header {
+        char     magic[8];
+        uint32_t version;
+        uint32_t elemSize;
+        uint32_t elemAlign;
+        uint32_t reserved;
+        uint64_t size;
+        uint64_t capacity;
+        char     padding[24];
+    };
+    static_assert(sizeof(Header) == 64, "header must be 64 bytes");
+    static constexpr uint32_t format_version = 1;
+    static constexpr char format_magic[8] = {'M', 'Y', 'V', 'E', 'C', 'M', 'A', 'P'};
+
+    int     _fd;        // 文件描述符
+    Header* _header;    // 映射起始地址（文件头）
+    T*      _data;      // 紧跟文件头的元素区
+    size_t  _mapped;    // 当前映射的字节数
+
+public:
+    /* ===== 构造 / 析构 ===== */
+    explicit myMappedVector(const std::string& path);
+    ~myMappedVector();
+    myMappedVector(const myMappedVector&) = delete;
+    myMappedVector& operator=(const myMappedVector&) = delete;
+    myMappedVector(myMappedVector&& other) noexcept;
+    myMappedVector& operator=(myMappedVector&& other) noexcept;
+
+    /* ===== 容量相关 ===== */
+    size_t size() const noexcept;
+    size_t capacity() const noexcept;
+    bool empty() const noexcept;
+    void resize(size_t newSize);
+    void reserve(size_t newCapacity);
+
+    /* ===== 元素访问 ===== */
+    T& operator[](size_t index);
+    const T& operator[](size_t index) const;
+    T& at(size_t index);
+    const T& at(size_t index) const;
+    T& front();
+    T& back();
+
+    /* ===== 迭代器 ===== */
+    using iterator = T*;
+    using const_iterator = const T*;
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    /* ===== 修改器 ===== */
+    void push_back(const T& value);
+    void pop_back();
+    void clear();
+
+    /* ===== 持久化 ===== */
+    void flush();
+
+private:
+    /* ===== 内部工具 ===== */
+    static size_t file_bytes(size_t capacity) noexcept;
+    void map_file(size_t bytes);
+    void remap(size_t newCapacity);
+    void close() noexcept;
+    [[noreturn]] static void throw_errno(const char* what);
+};
+
+
+// ==========================================================
+// Implementation - Constructors / Destructor
+// ==========================================================
+
+template <typename T>
+myMappedVector<T>::myMappedVector(const std::string& path) : _fd(-1), _header(nullptr), _data(nullptr), _mapped(0) {
+    _fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (_fd < 0) {
+        throw_errno("open");
+    }
+    try {
+        struct stat st;
+        if (::fstat(_fd, &st) != 0) {
+            throw_errno("fstat");
+        }
+        if (st.st_size == 0) {
+            // 新文件：写入文件头，初始容量为 0
+            if (::ftruncate(_fd, static_cast<off_t>(file_bytes(0))) != 0) {
+                throw_errno("ftruncate");
+            }
+            map_file(file_bytes(0));
+            std::memcpy(_header->magic, format_magic, sizeof(format_magic));
+            _header->version = format_version;
+            _header->elemSize = sizeof(T);
+            _header->elemAlign = alignof(T);
+            _header->size = 0;
+            _header->capacity = 0;
+        } else {
+            // 已有文件：校验文件头，不解析任何元素
+            if (static_cast<size_t>(st.st_size) < sizeof(Header)) {
+                throw std::runtime_error("myMappedVector: file too small");
+            }
+            map_file(static_cast<size_t>(st.st_size));
+            if (std::memcmp(_header->magic, format_magic, sizeof(format_magic)) != 0) {
+                throw std::runtime_error("myMappedVector: bad magic");
+            }
+            if (_header->version != format_version) {
+                throw std::runtime_error("myMappedVector: unsupported version");
+            }
+            if (_header->elemSize != sizeof(T) || _header->elemAlign != alignof(T)) {
+                throw std::runtime_error("myMappedVector: element type mismatch");
+            }
+            if (file_bytes(_header->capacity) > static_cast<size_t>(st.st_size) || _header->size > _header->capacity) {
+                throw std::runtime_error("myMappedVector: corrupted header");
+            }
+        }
+    } catch (...) {
+        close();
+        throw;
+    }
+}
+
+template <typename T>
+myMappedVector<T>::~myMappedVector() {
+    close();
+}
+
+template <typename T>
+myMappedVector<T>::myMappedVector(myMappedVector&& other) noexcept
+    : _fd(std::exchange(other._fd, -1)), _header(std::exchange(other._header, nullptr)), _data(std::exchange(other._data, nullptr)),
+      _mapped(std::exchange(other._mapped, 0)) {}
+
+template <typename T>
+myMappedVector<T>& myMappedVector<T>::operator=(myMappedVector&& other) noexcept {
+    if (this != &other) {
+        close();
+        _fd = std::exchange(other._fd, -1);
+        _header = std::exchange(other._header, nullptr);
+        _data = std::exchange(other._data, nullptr);
+        _mapped = std::exchange(other._mapped, 0);
+    }
+    return *this;
+}
+
+// ==========================================================
+// Implementation - Capacity
+// ==========================================================
+
+template <typename T>
+size_t myMappedVector<T>::size() const noexcept {
+    return _header ? static_cast<size_t>(_header->size) : 0;
+}
+
+template <typename T>
+size_t myMappedVector<T>::capacity() const noexcept {
+    return _header ? static_cast<size_t>(_header->capacity) : 0;
+}
+
+template <typename T>
+bool myMappedVector<T>::empty() const noexcept {
+    return size() == 0;
+}
+
+template <typename T>
+void myMappedVector<T>::resize(size_t newSize) {
+    size_t oldSize = size();
+    if (newSize > capacity()) {
+        remap(myGrowthDoubling::grow(capacity(), newSize, sizeof(T)));
+    }
+    if (newSize > oldSize) {
+        std::memset(static_cast<void*>(_data + oldSize), 0, (newSize - oldSize) * sizeof(T));
+    }
+    _header->size = newSize;
+}
+
+template <typename T>
+void myMappedVector<T>::reserve(size_t newCapacity) {
+    if (newCapacity <= capacity()) {
+        return;
+    }
+    remap(newCapacity);
+}
+
+// ==========================================================
+// Implementation - Element Access
+// ==========================================================
+
+template <typename T>
+T& myMappedVector<T>::operator[](size_t index) {
+    return _data[index];
+}
+
+template <typename T>
+const T& myMappedVector<T>::operator[](size_t index) const {
+    return _data[index];
+}
+
+template <typename T>
+T& myMappedVector<T>::at(size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return _data[index];
+}
+
+template <typename T>
+const T& myMappedVector<T>::at(size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return _data[index];
+}
+
+template <typename T>
+T& myMappedVector<T>::front() {
+    return _data[0];
+}
+
+template <typename T>
+T& myMappedVector<T>::back() {
+    return _data[size() - 1];
+}
+
+// ==========================================================
+// Implementation - Iterators
+// ==========================================================
+
+template <typename T>
+typename myMappedVector<T>::iterator myMappedVector<T>::begin() noexcept {
+    return _data;
+}
+
+template <typename T>
+typename myMappedVector<T>::iterator myMappedVector<T>::end() noexcept {
+    return _data + size();
+}
+
+template <typename T>
+typename myMappedVector<T>::const_iterator myMappedVector<T>::begin() const noexcept {
+    return _data;
+}
+
+template <typename T>
+typename myMappedVector<T>::const_iterator myMappedVector<T>::end() const noexcept {
+    return _data + size();
+}
+
+// ==========================================================
+// Implementation - Modifiers
+// ==========================================================
+
+template <typename T>
+void myMappedVector<T>::push_back(const T& value) {
+    size_t n = size();
+    if (n >= capacity()) {
+        T copy = value; // value 可能位于映射区内，重新映射后会失效
+        remap(myGrowthDoubling::grow(capacity(), n + 1, sizeof(T)));
+        std::memcpy(static_cast<void*>(_data + n), &copy, sizeof(T));
+    } else {
+        std::memcpy(static_cast<void*>(_data + n), &value, sizeof(T));
+    }
+    _header->size = n + 1;
+}
+
+template <typename T>
+void myMappedVector<T>::pop_back() {
+    if (size() > 0) {
+        _header->size --;
+    }
+}
+
+template <typename T>
+void myMappedVector<T>::clear() {
+    _header->size = 0;
+}
+
+// ==========================================================
+// Implementation - Persistence
+// ==========================================================
+
+template <typename T>
+void myMappedVector<T>::flush() {
+    if (_header != nullptr && ::msync(_header, _mapped, MS_SYNC) != 0) {
+        throw_errno("msync");
+    }
+}
+
+// ==========================================================
+// Implementation - Internal Tools
+// ==========================================================
+
+template <typename T>
+size_t myMappedVector<T>::file_bytes(size_t capacity) noexcept {
+    return sizeof(Header) + capacity * sizeof(T);
+}
+
+template <typename T>
+void myMappedVector<T>::map_file(size_t bytes) {
+    void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (p == MAP_FAILED) {
+        throw_errno("mmap");
+    }
+    _header = static_cast<Header*>(p);
+    _data = reinterpret_cast<T*>(static_cast<char*>(p) + sizeof(Header));
+    _mapped = bytes;
+}
+
+// 扩大文件并重新映射；失败时抛异常，原映射保持可用
+template <typename T>
+void myMappedVector<T>::remap(size_t newCapacity) {
+    size_t oldBytes = _mapped, newBytes = file_bytes(newCapacity);
+    if (::ftruncate(_fd, static_cast<off_t>(newBytes)) != 0) {
+        throw_errno("ftruncate");
+    }
+#if defined(__linux__)
+    void* p = ::mremap(_header, oldBytes, newBytes, MREMAP_MAYMOVE);
+    if (p == MAP_FAILED) {
+        throw_errno("mremap");
+    }
+    _header = static_cast<Header*>(p);
+    _data = reinterpret_cast<T*>(static_cast<char*>(p) + sizeof(Header));
+#else
+    void* p = ::mmap(nullptr, newBytes, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (p == MAP_FAILED) {
+        throw_errno("mmap");
+    }
+    ::munmap(_header, oldBytes);
+    _header = static_cast<Header*>(p);
+    _data = reinterpret_cast<T*>(static_cast<char*>(p) + sizeof(Header));
+#endif
+    _mapped = newBytes;
+    _header->capacity = newCapacity;
+}
+
+template <typename T>
+void myMappedVector<T>::close() noexcept {
+    if (_header != nullptr) {
+        ::munmap(_header, _mapped);
+        _header = nullptr;
+        _data = nullptr;
+        _mapped = 0;
+    }
+    if (_fd >= 0) {
+        ::close(_fd);
+        _fd = -1;
+    }
+}
+
+template <typename T>
+void myMappedVector<T>::throw_errno(const char* what) {
+    throw std::system_error(errno, std::generic_category(), std::string("myMappedVector: ") + what);
+}
+
+#endif // MY_MAPPED_VECTOR_H
@@ -0,0 +1,273 @@
+#ifndef MY_PACKED_VECTOR_H
+#define MY_PACKED_VECTOR_H
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t, uint64_t
+#include <stdexcept>    // std::out_of_range
+#include <type_traits>  // std::conditional_t
+#include <utility>      // std::index_sequence
+#include "myVector.h"
+
+// ==========================================================
+// myPackedVector<Bits>：定宽位压缩的无符号整数序列
+// ==========================================================
+// intVector 每个元素固定 4 字节；当取值范围已知（如 ID < 1024 只需 10 bit）时，
+// myPackedVector<10> 把元素首尾相接地存进 64 位字数组，内存缩小为 Bits / 32：
+//
+//   元素 i 占据第 [i * Bits, (i + 1) * Bits) 位，可能跨越两个相邻的字
+//
+//   _words[0]: | e0 | e1 | e2 | e3 | e4 | e5 | e6 (低 4 位) |
+//   _words[1]: | e6 (高 6 位) | e7 | ...
+//
+// 随机访问需要一次乘法与至多两次读字；顺序解码时用 unpack() 批量展开到缓冲区：
+// 每 64 个元素恰好占 Bits 个整字，块内偏移在编译期展开为常量移位与掩码，
+// 没有分支，编译器可以自动向量化；不对齐的首尾部分维护 "当前字 + 位偏移" 两个游标。
+
+template <size_t Bits>
+class myPackedVector {
+    static_assert(Bits >= 1 && Bits <= 64, "Bits must be in [1, 64]");
+public:
+    using value_type = std::conditional_t<(Bits <= 32), uint32_t, uint64_t>;
+    static constexpr value_type max_value = static_cast<value_type>(Bits == 64 ? ~uint64_t(0) : (uint64_t(1) << Bits) - 1);
+
+private:
+    using word_type = uint64_t;
+    static constexpr size_t word_bits = 64;
+    static constexpr word_type mask = static_cast<word_type>(max_value);
+
+    myVector<word_type> _words;     // 位存储
+    size_t _size;                   // 元素个数
+
+public:
+    // 单个元素的代理引用
+    class reference {
+    public:
+        reference(myPackedVector* owner, size_t index) : _owner(owner), _index(index) {}
+        operator value_type() const { return _owner->get(_index); }
+        reference& operator=(value_type value) { _owner->set(_index, value); return *this; }
+        reference& operator=(const reference& other) { return *this = value_type(other); }
+
+    private:
+        myPackedVector* _owner;
+        size_t _index;
+    };
+
+    /* ===== 构造 ===== */
+    myPackedVector() : _size(0) {}
+    explicit myPackedVector(size_t count, value_type value = 0);
+
+    /* ===== 容量相关 ===== */
+    size_t size() const noexcept { return _size; }
+    bool empty() const noexcept { return _size == 0; }
+    void reserve(size_t count) { _words.reserve(word_count(count)); }
+    void resize(size_t newSize, value_type value = 0);
+    size_t memory_bytes() const noexcept { return _words.capacity() * sizeof(word_type); }
+
+    /* ===== 元素访问 ===== */
+    value_type get(size_t index) const;
+    value_type operator[](size_t index) const { return get(index); }
+    reference operator[](size_t index) { return reference(this, index); }
+    value_type at(size_t index) const;
+    value_type back() const { return get(_size - 1); }
+
+    /* ===== 修改器 ===== */
+    void set(size_t index, value_type value);
+    void push_back(value_type value);
+    void pop_back();
+    void clear() { _words.clear(); _size = 0; }
+    void append(const value_type* values, size_t count);
+
+    /* ===== 批量解码 ===== */
+    // 把 [first, first + count) 解码到 out，返回实际解码个数
+    size_t unpack(size_t first, size_t count, value_type* out) const;
+
+private:
+    /* ===== 内部工具 ===== */
+    static size_t word_count(size_t count) noexcept { return (count * Bits + word_bits - 1) / word_bits; }
+    static constexpr size_t block_size = word_bits;
+    static void check_value(value_type value);
+    template <size_t... K>
+    static void unpack_block(const word_type* src, value_type* out, std::index_sequence<K...>) noexcept;
+    template <size_t K>
+    static value_type extract(const word_type* src) noexcept;
+    void store(size_t index, value_type value) noexcept;
+};
+
+
+// ==========================================================
+// Implementation - Constructors / Capacity
+// ==========================================================
+
+template <size_t Bits>
+myPackedVector<Bits>::myPackedVector(size_t count, value_type value) : _size(0) {
+    resize(count, value);
+}
+
+template <size_t Bits>
+void myPackedVector<Bits>::resize(size_t newSize, value_type value) {
+    check_value(value);
+    size_t oldSize = _size;
+    _words.resize(word_count(newSize), word_type(0));
+    _size = newSize;
+    size_t used = (newSize * Bits) % word_bits;
+    if (newSize < oldSize && used != 0) {
+        // 截断后清零最后一个字的多余高位，保证新追加的元素可以直接按位写入
+        _words.back() &= ~word_type(0) >> (word_bits - used);
+    }
+    if (value != 0) {
+        for (size_t i = oldSize; i < newSize; ++ i) {
+            store(i, value);
+        }
+    }
+}
+
+// ==========================================================
+// Implementation - Access
+// ==========================================================
+
+template <size_t Bits>
+typename myPackedVector<Bits>::value_type myPackedVector<Bits>::get(size_t index) const {
+    size_t bit = index * Bits;
+    size_t w = bit / word_bits;
+    size_t offset = bit % word_bits;
+    word_type value = _words[w] >> offset;
+    if (offset + Bits > word_bits) {
+        value |= _words[w + 1] << (word_bits - offset);
+    }
+    return static_cast<value_type>(value & mask);
+}
+
+template <size_t Bits>
+typename myPackedVector<Bits>::value_type myPackedVector<Bits>::at(size_t index) const {
+    if (index >= _size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return get(index);
+}
+
+// ==========================================================
+// Implementation - Modifiers
+// ==========================================================
+
+template <size_t Bits>
+void myPackedVector<Bits>::set(size_t index, value_type value) {
+    check_value(value);
+    store(index, value);
+}
+
+template <size_t Bits>
+void myPackedVector<Bits>::push_back(value_type value) {
+    check_value(value);
+    size_t need = word_count(_size + 1);
+    if (need > _words.size()) {
+        _words.push_back(word_type(0));
+    }
+    store(_size, value);
+    _size ++;
+}
+
+template <size_t Bits>
+void myPackedVector<Bits>::pop_back() {
+    if (_size > 0) {
+        _size --;
+        store(_size, 0);
+        _words.resize(word_count(_size));
+    }
+}
+
+template <size_t Bits>
+void myPackedVector<Bits>::append(const value_type* values, size_t count) {
+    for (size_t i = 0; i < count; ++ i) {
+        check_value(values[i]);
+    }
+    _words.resize(word_count(_size + count), word_type(0));
+    for (size_t i = 0; i < count; ++ i) {
+        store(_size + i, values[i]);
+    }
+    _size += count;
+}
+
+// ==========================================================
+// Implementation - Bulk Decode
+// ==========================================================
+
+template <size_t Bits>
+size_t myPackedVector<Bits>::unpack(size_t first, size_t count, value_type* out) const {
+    if (first >= _size) {
+        return 0;
+    }
+    if (count > _size - first) {
+        count = _size - first;
+    }
+    const word_type* words = _words.begin();
+    size_t i = 0;
+    // 快速路径：每 64 个元素恰好占 Bits 个整字，偏移模式在编译期已知，整块展开
+    if (first % block_size == 0) {
+        const word_type* src = words + first / block_size * Bits;
+        for (; i + block_size <= count; i += block_size, src += Bits) {
+            unpack_block(src, out + i, std::make_index_sequence<block_size>{});
+        }
+    }
+    size_t bit = (first + i) * Bits;
+    size_t w = bit / word_bits;
+    size_t offset = bit % word_bits;
+    for (; i < count; ++ i) {
+        word_type value = words[w] >> offset;
+        offset += Bits;
+        if (offset >= word_bits) {
+            offset -= word_bits;
+            w ++;
+            // 跨字：从下一个字补齐高位（offset == 0 时恰好用完当前字）
+            if (offset != 0) {
+                value |= words[w] << (Bits - offset);
+            }
+        }
+        out[i] = static_cast<value_type>(value & mask);
+    }
+    return count;
+}
+
+// ==========================================================
+// Implementation - Internal Tools
+// ==========================================================
+
+template <size_t Bits>
+void myPackedVector<Bits>::check_value(value_type value) {
+    if (value > max_value) {
+        throw std::out_of_range("Value does not fit in packed width");
+    }
+}
+
+template <size_t Bits>
+template <size_t... K>
+void myPackedVector<Bits>::unpack_block(const word_type* src, value_type* out, std::index_sequence<K...>) noexcept {
+    ((out[K] = extract<K>(src)), ...);
+}
+
+// 块内第 K 个元素：字下标与位偏移均为常量
+template <size_t Bits>
+template <size_t K>
+typename myPackedVector<Bits>::value_type myPackedVector<Bits>::extract(const word_type* src) noexcept {
+    constexpr size_t w = K * Bits / word_bits;
+    constexpr size_t offset = K * Bits % word_bits;
+    word_type value = src[w] >> offset;
+    if constexpr (offset + Bits > word_bits) {
+        value |= src[w + 1] << (word_bits - offset);
+    }
+    return static_cast<value_type>(value & mask);
+}
+
+template <size_t Bits>
+void myPackedVector<Bits>::store(size_t index, value_type value) noexcept {
+    size_t bit = index * Bits;
+    size_t w = bit / word_bits;
+    size_t offset = bit % word_bits;
+    word_type v = static_cast<word_type>(value);
+    _words[w] = (_words[w] & ~(mask << offset)) | (v << offset);
+    if (offset + Bits > word_bits) {
+        size_t spill = word_bits - offset;
+        _words[w + 1] = (_words[w + 1] & ~(mask >> spill)) | (v >> spill);
+    }
+}
+
+#endif // MY_PACKED_VECTOR_H
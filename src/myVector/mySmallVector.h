@@ -0,0 +1,634 @@
+#ifndef MY_SMALL_VECTOR_H
+#define MY_SMALL_VECTOR_H
+
+#include <cstddef>      // size_t
+#include <utility>      // std::move, std::forward
+#include <stdexcept>    // std::out_of_range
+#include <memory>       // std::allocator, std::allocator_traits
+#include <type_traits>  // std::is_nothrow_move_constructible
+#include <cstring>      // std::memcpy, std::memmove
+#include <initializer_list>
+#include "myVector.h"   // is_trivially_relocatable
+#include "growthPolicy.h"
+
+// ==========================================================
+// mySmallVector：小缓冲区优化 (Small Buffer Optimization) 的 vector
+// ==========================================================
+// 前 N 个元素直接存放在对象内部的缓冲区中，不触发任何堆分配；
+// 超过 N 个后才向 Alloc 申请内存，此后行为与 myVector 一致。
+//
+// ┌──────────────────────────────┐
+// │ _data ──┐   _size  _capacity │
+// │ ┌───────▼──────────────────┐ │   size <= N：_data 指向内联缓冲区
+// │ │  inline buffer (N * T)   │ │
+// │ └──────────────────────────┘ │   size >  N：_data 指向堆内存
+// └──────────────────────────────┘
+//
+// 与 myVector 的区别：
+//     - 移动构造/赋值在内联状态下必须逐个移动元素（无法"偷"指针），
+//       因此仅当 T 的移动构造不抛异常时才是 noexcept。
+//     - 分配器按 propagate_on_container_* 传播；移动赋值时若分配器既不传播也不相等，
+//       对方的堆内存不能接管，只能逐元素移动到自己分配的内存中（此时不是 noexcept）。
+//     - 扩容后不会回到内联缓冲区（与 myVector 一样 "易增难减"）。
+//     - 扩容策略固定为 myGrowthDoubling（growthPolicy.h），不像 myVector 那样可由模板参数替换。
+
+template <typename T, size_t N, typename Alloc = std::allocator<T>>
+class mySmallVector {
+    static_assert(N > 0, "inline capacity must be positive");
+private:
+    T*      _data;      // 指向内联缓冲区或堆内存
+    size_t  _size;      // 已构造元素个数
+    size_t  _capacity;  // 可容纳元素个数（内联时为 N）
+    alignas(T) unsigned char _inline[N * sizeof(T)]; // 内联缓冲区（原始内存）
+
+public:
+    /* ===== 构造 / 析构 ===== */
+    mySmallVector();
+    explicit mySmallVector(const Alloc& alloc);
+    ~mySmallVector();
+    mySmallVector(const mySmallVector& other);
+    mySmallVector& operator=(const mySmallVector& other);
+    mySmallVector(mySmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    mySmallVector& operator=(mySmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>
+        && (std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value
+            || std::allocator_traits<Alloc>::is_always_equal::value));
+    mySmallVector(std::initializer_list<T> ilist);
+
+    /* ===== 容量相关 ===== */
+    size_t size() const noexcept;
+    size_t capacity() const noexcept;
+    bool empty() const noexcept;
+    bool is_small() const noexcept;     // 是否仍在使用内联缓冲区
+    Alloc get_allocator() const;
+    void resize(size_t newSize);
+    void resize(size_t newSize, const T& value);
+
+    /* ===== 元素访问 ===== */
+    T& operator[](size_t index);
+    const T& operator[](size_t index) const;
+    T& at(size_t index);
+    const T& at(size_t index) const;
+    T& front();
+    const T& front() const;
+    T& back();
+    const T& back() const;
+
+    /* ===== 迭代器 ===== */
+    using iterator = T*;
+    using const_iterator = const T*;
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    /* ===== 修改器 ===== */
+    void push_back(const T& value);
+    void push_back(T&& value);
+    void pop_back();
+    void clear();
+    void reserve(size_t newCapacity);
+    template <typename ... Args>
+    void emplace_back(Args&& ... args);
+    template <typename ... Args>
+    iterator emplace(const_iterator pos, Args&& ... args);
+    iterator insert(const_iterator pos, const T& value);
+    iterator insert(const_iterator pos, T&& value);
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+    void swap(mySmallVector& other);
+
+private:
+    /* ===== 内部工具 ===== */
+    Alloc allocator;
+    using traits = std::allocator_traits<Alloc>;
+    T* inline_data() noexcept;
+    const T* inline_data() const noexcept;
+    void reallocate(size_t newCapacity);
+    void destroy_range(size_t from, size_t to);
+    void release();
+    void reset_inline() noexcept;       // release 之后回到空的内联状态
+    void steal(mySmallVector& other);
+};
+
+
+// ==========================================================
+// Implementation - Constructors / Destructor
+// ==========================================================
+
+template <typename T, size_t N, typename Alloc>
+mySmallVector<T, N, Alloc>::mySmallVector() : _data(inline_data()), _size(0), _capacity(N) {}
+
+template <typename T, size_t N, typename Alloc>
+mySmallVector<T, N, Alloc>::mySmallVector(const Alloc& alloc) : _data(inline_data()), _size(0), _capacity(N), allocator(alloc) {}
+
+template <typename T, size_t N, typename Alloc>
+mySmallVector<T, N, Alloc>::~mySmallVector() {
+    destroy_range(0, _size);
+    release();
+}
+
+template <typename T, size_t N, typename Alloc>
+mySmallVector<T, N, Alloc>::mySmallVector(const mySmallVector& other)
+    : _data(inline_data()), _size(0), _capacity(N), allocator(traits::select_on_container_copy_construction(other.allocator)) {
+        try {
+            reserve(other._size);
+            for (; _size < other._size; _size ++) {
+                traits::construct(allocator, &_data[_size], other._data[_size]);
+            }
+        } catch (...) {
+            // 构造函数抛异常时析构函数不会执行，需要手动回滚
+            destroy_range(0, _size);
+            release();
+            throw;
+        }
+    }
+
+// propagate_on_container_copy_assignment 为真且分配器不相等时，
+// 旧堆内存必须先由旧分配器释放，再换成对方的分配器
+template <typename T, size_t N, typename Alloc>
+mySmallVector<T, N, Alloc>& mySmallVector<T, N, Alloc>::operator=(const mySmallVector& other) {
+    if (this != &other) {
+        clear();
+        if constexpr (traits::propagate_on_container_copy_assignment::value) {
+            if (allocator != other.allocator) {
+                release();
+                reset_inline();
+            }
+            allocator = other.allocator;
+        }
+        reserve(other._size);
+        for (; _size < other._size; _size ++) {
+            traits::construct(allocator, &_data[_size], other._data[_size]);
+        }
+    }
+    return *this;
+}
+
+// 移动后 other 是合法的空 vector，可以继续使用；
+// 因此分配器要拷贝而非移动（标准要求移动后的分配器与原值相等，如节点池的 shared_ptr 不能被掏空）
+template <typename T, size_t N, typename Alloc>
+mySmallVector<T, N, Alloc>::mySmallVector(mySmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    : _data(inline_data()), _size(0), _capacity(N), allocator(other.allocator) {
+        steal(other);
+    }
+
+// 与 myVector 相同：
+//     - 对方在堆上，且分配器传播或两者相等：用旧分配器释放自己的堆内存，直接接管对方的指针
+//     - 对方内联：逐个移动元素；分配器传播且不相等时先释放旧堆内存再换分配器
+//     - 对方在堆上但分配器既不传播也不相等：对方的内存只能由对方释放，用自己的分配器逐元素移动
+template <typename T, size_t N, typename Alloc>
+mySmallVector<T, N, Alloc>& mySmallVector<T, N, Alloc>::operator=(mySmallVector&& other)
+    noexcept(std::is_nothrow_move_constructible_v<T>
+             && (traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value)) {
+    if (this == &other) {
+        return *this;
+    }
+    clear();
+    if (other.is_small()) {
+        // 元素不超过 N 个，自身缓冲区（内联或堆上）必然放得下
+        if constexpr (traits::propagate_on_container_move_assignment::value) {
+            if (allocator != other.allocator) {
+                release();
+                reset_inline();
+            }
+            allocator = other.allocator;
+        }
+        steal(other);
+        return *this;
+    }
+    if (traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value
+        || allocator == other.allocator) {
+        release();
+        reset_inline();
+        if constexpr (traits::propagate_on_container_move_assignment::value) {
+            allocator = other.allocator;
+        }
+        steal(other);
+        return *this;
+    }
+    reserve(other._size);
+    for (; _size < other._size; _size ++) {
+        traits::construct(allocator, &_data[_size], std::move(other._data[_size]));
+    }
+    other.clear();
+    return *this;
+}
+
+template <typename T, size_t N, typename Alloc>
+mySmallVector<T, N, Alloc>::mySmallVector(std::initializer_list<T> ilist) : _data(inline_data()), _size(0), _capacity(N) {
+    try {
+        reserve(ilist.size());
+        for (const T& value : ilist) {
+            traits::construct(allocator, &_data[_size], value);
+            _size ++;
+        }
+    } catch (...) {
+        destroy_range(0, _size);
+        release();
+        throw;
+    }
+}
+
+// ==========================================================
+// Implementation - Capacity
+// ==========================================================
+
+template <typename T, size_t N, typename Alloc>
+size_t mySmallVector<T, N, Alloc>::size() const noexcept {
+    return _size;
+}
+
+template <typename T, size_t N, typename Alloc>
+size_t mySmallVector<T, N, Alloc>::capacity() const noexcept {
+    return _capacity;
+}
+
+template <typename T, size_t N, typename Alloc>
+bool mySmallVector<T, N, Alloc>::empty() const noexcept {
+    return _size == 0;
+}
+
+template <typename T, size_t N, typename Alloc>
+bool mySmallVector<T, N, Alloc>::is_small() const noexcept {
+    return _data == inline_data();
+}
+
+template <typename T, size_t N, typename Alloc>
+Alloc mySmallVector<T, N, Alloc>::get_allocator() const {
+    return allocator;
+}
+
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::resize(size_t newSize) {
+    if (newSize < _size) {
+        destroy_range(newSize, _size);
+        _size = newSize;
+        return;
+    }
+    if (newSize > _capacity) {
+        reallocate(myGrowthDoubling::grow(_capacity, newSize, sizeof(T)));
+    }
+    for (; _size < newSize; _size ++) {
+        traits::construct(allocator, &_data[_size]);
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::resize(size_t newSize, const T& value) {
+    if (newSize < _size) {
+        destroy_range(newSize, _size);
+        _size = newSize;
+        return;
+    }
+    if (newSize > _capacity) {
+        T copy(value); // value 可能引用自身元素，扩容前先复制
+        reallocate(myGrowthDoubling::grow(_capacity, newSize, sizeof(T)));
+        for (; _size < newSize; _size ++) {
+            traits::construct(allocator, &_data[_size], copy);
+        }
+        return;
+    }
+    for (; _size < newSize; _size ++) {
+        traits::construct(allocator, &_data[_size], value);
+    }
+}
+
+// ==========================================================
+// Implementation - Element Access
+// ==========================================================
+
+template <typename T, size_t N, typename Alloc>
+T& mySmallVector<T, N, Alloc>::operator[](size_t index) {
+    return _data[index];
+}
+
+template <typename T, size_t N, typename Alloc>
+const T& mySmallVector<T, N, Alloc>::operator[](size_t index) const {
+    return _data[index];
+}
+
+template <typename T, size_t N, typename Alloc>
+T& mySmallVector<T, N, Alloc>::at(size_t index) {
+    if (index >= _size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return _data[index];
+}
+
+template <typename T, size_t N, typename Alloc>
+const T& mySmallVector<T, N, Alloc>::at(size_t index) const {
+    if (index >= _size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return _data[index];
+}
+
+template <typename T, size_t N, typename Alloc>
+T& mySmallVector<T, N, Alloc>::front() {
+    return _data[0];
+}
+
+template <typename T, size_t N, typename Alloc>
+const T& mySmallVector<T, N, Alloc>::front() const {
+    return _data[0];
+}
+
+template <typename T, size_t N, typename Alloc>
+T& mySmallVector<T, N, Alloc>::back() {
+    return _data[_size - 1];
+}
+
+template <typename T, size_t N, typename Alloc>
+const T& mySmallVector<T, N, Alloc>::back() const {
+    return _data[_size - 1];
+}
+
+// ==========================================================
+// Implementation - Iterators
+// ==========================================================
+
+template <typename T, size_t N, typename Alloc>
+typename mySmallVector<T, N, Alloc>::iterator mySmallVector<T, N, Alloc>::begin() noexcept {
+    return _data;
+}
+
+template <typename T, size_t N, typename Alloc>
+typename mySmallVector<T, N, Alloc>::iterator mySmallVector<T, N, Alloc>::end() noexcept {
+    return _data + _size;
+}
+
+template <typename T, size_t N, typename Alloc>
+typename mySmallVector<T, N, Alloc>::const_iterator mySmallVector<T, N, Alloc>::begin() const noexcept {
+    return _data;
+}
+
+template <typename T, size_t N, typename Alloc>
+typename mySmallVector<T, N, Alloc>::const_iterator mySmallVector<T, N, Alloc>::end() const noexcept {
+    return _data + _size;
+}
+
+// ==========================================================
+// Implementation - Modifiers
+// ==========================================================
+
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::push_back(const T& value) {
+    emplace_back(value);
+}
+
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
+
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::pop_back() {
+    if (_size > 0) {
+        -- _size;
+        traits::destroy(allocator, &_data[_size]);
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::clear() {
+    destroy_range(0, _size);
+    _size = 0;
+}
+
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::reserve(size_t newCapacity) {
+    if (newCapacity <= _capacity) {
+        return;
+    }
+    reallocate(newCapacity);
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename ... Args>
+void mySmallVector<T, N, Alloc>::emplace_back(Args&& ... args) {
+    if (_size >= _capacity) {
+        // 参数可能引用自身元素（如 v.push_back(v[0])），扩容前先构造出临时对象
+        T temp(std::forward<Args>(args)...);
+        reallocate(myGrowthDoubling::grow(_capacity, _size + 1, sizeof(T)));
+        traits::construct(allocator, &_data[_size], std::move(temp));
+    } else {
+        traits::construct(allocator, &_data[_size], std::forward<Args>(args)...);
+    }
+    _size ++;
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename ... Args>
+typename mySmallVector<T, N, Alloc>::iterator mySmallVector<T, N, Alloc>::emplace(const_iterator pos, Args&& ... args) {
+    if (pos < begin() || pos > end()) {
+        throw std::out_of_range("Insert position out of range");
+    }
+    size_t index = pos - begin();
+    if (index == _size) {
+        emplace_back(std::forward<Args>(args)...);
+        return begin() + index;
+    }
+    // 先构造新元素，再搬移已有元素：args 引用自身元素时依然安全
+    T temp(std::forward<Args>(args)...);
+    if (_size >= _capacity) {
+        reallocate(myGrowthDoubling::grow(_capacity, _size + 1, sizeof(T)));
+    }
+    if constexpr (is_trivially_relocatable_v<T>) {
+        std::memmove(static_cast<void*>(_data + index + 1), static_cast<const void*>(_data + index), (_size - index) * sizeof(T));
+        try {
+            traits::construct(allocator, &_data[index], std::move(temp));
+        } catch (...) {
+            std::memmove(static_cast<void*>(_data + index), static_cast<const void*>(_data + index + 1), (_size - index) * sizeof(T));
+            throw;
+        }
+    } else {
+        traits::construct(allocator, &_data[_size], std::move(_data[_size - 1]));
+        _size ++;
+        for (size_t i = _size - 2; i > index; i --) {
+            _data[i] = std::move(_data[i - 1]);
+        }
+        _data[index] = std::move(temp);
+        return begin() + index;
+    }
+    _size ++;
+    return begin() + index;
+}
+
+template <typename T, size_t N, typename Alloc>
+typename mySmallVector<T, N, Alloc>::iterator mySmallVector<T, N, Alloc>::insert(const_iterator pos, const T& value) {
+    return emplace(pos, value);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename mySmallVector<T, N, Alloc>::iterator mySmallVector<T, N, Alloc>::insert(const_iterator pos, T&& value) {
+    return emplace(pos, std::move(value));
+}
+
+template <typename T, size_t N, typename Alloc>
+typename mySmallVector<T, N, Alloc>::iterator mySmallVector<T, N, Alloc>::erase(const_iterator pos) {
+    if (pos < begin() || pos >= end()) {
+        throw std::out_of_range("Erase position out of range");
+    }
+    return erase(pos, pos + 1);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename mySmallVector<T, N, Alloc>::iterator mySmallVector<T, N, Alloc>::erase(const_iterator first, const_iterator last) {
+    if (first < begin() || last > end() || first > last) {
+        throw std::out_of_range("Erase range out of range");
+    }
+    size_t startIndex = first - begin(), endIndex = last - begin();
+    size_t count = endIndex - startIndex;
+    if constexpr (is_trivially_relocatable_v<T>) {
+        destroy_range(startIndex, endIndex);
+        std::memmove(static_cast<void*>(_data + startIndex), static_cast<const void*>(_data + endIndex), (_size - endIndex) * sizeof(T));
+    } else {
+        for (size_t i = endIndex; i < _size; i ++) {
+            _data[i - count] = std::move(_data[i]);
+        }
+        destroy_range(_size - count, _size);
+    }
+    _size -= count;
+    return begin() + startIndex;
+}
+
+// 堆内存随元素一起交换；仅在 propagate_on_container_swap 时交换分配器，否则两者必须相等（标准要求）
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::swap(mySmallVector& other) {
+    if (this == &other) {
+        return;
+    }
+    using std::swap;
+    if (!is_small() && !other.is_small()) {
+        // 双方都在堆上：与 myVector 一样只交换指针
+        swap(_data, other._data);
+        swap(_size, other._size);
+        swap(_capacity, other._capacity);
+    } else if (is_small() && other.is_small()) {
+        // 双方都内联：公共部分逐个交换，较长一方多出的元素移动到较短一方
+        mySmallVector& longer = _size >= other._size ? *this : other;
+        mySmallVector& shorter = _size >= other._size ? other : *this;
+        size_t common = shorter._size;
+        for (size_t i = 0; i < common; i ++) {
+            swap(_data[i], other._data[i]);
+        }
+        for (; shorter._size < longer._size; shorter._size ++) {
+            traits::construct(shorter.allocator, &shorter._data[shorter._size], std::move(longer._data[shorter._size]));
+        }
+        longer.destroy_range(common, longer._size);
+        longer._size = common;
+    } else {
+        // 一方内联、一方在堆上：内联的元素移动到堆上一方的内联缓冲区，堆内存交给原先内联的一方
+        mySmallVector& small = is_small() ? *this : other;
+        mySmallVector& large = is_small() ? other : *this;
+        T* heapData = large._data;
+        size_t heapSize = large._size, heapCapacity = large._capacity;
+        large.reset_inline();
+        large._size = 0;
+        try {
+            large.steal(small);
+        } catch (...) {
+            large.destroy_range(0, large._size);
+            large._data = heapData;
+            large._size = heapSize;
+            large._capacity = heapCapacity;
+            throw;
+        }
+        small._data = heapData;
+        small._size = heapSize;
+        small._capacity = heapCapacity;
+    }
+    if constexpr (traits::propagate_on_container_swap::value) {
+        swap(allocator, other.allocator);
+    }
+}
+
+// ==========================================================
+// Implementation - Internal Tools
+// ==========================================================
+
+template <typename T, size_t N, typename Alloc>
+T* mySmallVector<T, N, Alloc>::inline_data() noexcept {
+    return reinterpret_cast<T*>(_inline);
+}
+
+template <typename T, size_t N, typename Alloc>
+const T* mySmallVector<T, N, Alloc>::inline_data() const noexcept {
+    return reinterpret_cast<const T*>(_inline);
+}
+
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::reallocate(size_t newCapacity) {
+    // 与 myVector::reallocate 相同的强异常安全流程；区别在于旧内存若是内联缓冲区则不释放
+    T* newData = traits::allocate(allocator, newCapacity);
+    if constexpr (is_trivially_relocatable_v<T>) {
+        if (_size > 0) {
+            std::memcpy(static_cast<void*>(newData), static_cast<const void*>(_data), _size * sizeof(T));
+        }
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < _size; i ++) {
+                traits::construct(allocator, &newData[i], std::move_if_noexcept(_data[i]));
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; j ++) {
+                traits::destroy(allocator, &newData[j]);
+            }
+            traits::deallocate(allocator, newData, newCapacity);
+            throw;
+        }
+        destroy_range(0, _size);
+    }
+    release();
+    _data = newData;
+    _capacity = newCapacity;
+}
+
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::destroy_range(size_t from, size_t to) {
+    for (size_t i = from; i < to; i ++) {
+        traits::destroy(allocator, &_data[i]);
+    }
+}
+
+// 释放堆内存（内联缓冲区无需释放）；调用者负责之后重置 _data / _capacity
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::release() {
+    if (!is_small()) {
+        traits::deallocate(allocator, _data, _capacity);
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::reset_inline() noexcept {
+    _data = inline_data();
+    _capacity = N;
+}
+
+// 前置条件：*this 为空且 other 在堆上时 *this 处于内联状态
+// other 在堆上：接管指针；other 内联：逐个移动元素到自身缓冲区
+template <typename T, size_t N, typename Alloc>
+void mySmallVector<T, N, Alloc>::steal(mySmallVector& other) {
+    if (!other.is_small()) {
+        _data = other._data;
+        _size = other._size;
+        _capacity = other._capacity;
+        other._data = other.inline_data();
+        other._size = 0;
+        other._capacity = N;
+        return;
+    }
+    if constexpr (is_trivially_relocatable_v<T>) {
+        std::memcpy(static_cast<void*>(_data), static_cast<const void*>(other._data), other._size * sizeof(T));
+        _size = other._size;
+        other._size = 0; // 已按字节重定位，不再析构旧副本
+    } else {
+        for (; _size < other._size; _size ++) {
+            traits::construct(allocator, &_data[_size], std::move(other._data[_size]));
+        }
+        other.clear();
+    }
+}
+
+#endif // MY_SMALL_VECTOR_H
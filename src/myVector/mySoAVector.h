@@ -0,0 +1,258 @@
+#ifndef MY_SOA_VECTOR_H
+#define MY_SOA_VECTOR_H
+
+#include <cstddef>      // size_t
+#include <algorithm>    // std::min
+#include <tuple>        // std::tuple, std::get
+#include <utility>      // std::index_sequence
+#include <type_traits>  // std::conditional_t
+#include <stdexcept>    // std::out_of_range
+#include "myVector.h"
+#include "growthPolicy.h"
+
+// ==========================================================
+// mySoAVector：结构体数组 (Struct of Arrays) 布局的 vector
+// ==========================================================
+// AoS (myVector<Record>)：          SoA (mySoAVector<A, B, C>)：
+//   [a0 b0 c0][a1 b1 c1][a2 ...       col<0>: [a0 a1 a2 a3 ...]
+//                                     col<1>: [b0 b1 b2 b3 ...]
+//                                     col<2>: [c0 c1 c2 c3 ...]
+//
+// 热循环只读某一个字段时，AoS 每取一条 64B cache line 只用到其中几个字节；
+// SoA 下同一字段连续存放，cache line 与 SIMD 寄存器都被完全利用。
+//
+// 实现：每一列是一个 myVector<Field>，复用其扩容与异常安全逻辑；
+// mySoAVector 负责让所有列保持相同的 size，并按统一的容量扩容：
+//     - size() / capacity() 直接取自各列，不另外保存（拷贝 / 移动由各列完成，不会与列不一致）；
+//       列容量可能不同（如拷贝得到的列只分配 size 个元素），capacity() 取各列的最小值
+//     - 扩容由 myGrowthDoubling 统一算出新容量，再逐列 reserve
+//       （列类型是可变参数包，无法再追加 GrowthPolicy 模板参数，策略固定为翻倍）
+//     - push_back 逐列追加，任一列抛异常则回滚已追加的列（强保证）
+//
+// 访问方式：
+//     - column<I>()：返回第 I 列的连续视图 (myColumnSpan)，用于扫描 / SIMD
+//     - operator[](i)：返回行代理 row_reference，get<I>() 访问字段，模拟 AoS 访问
+
+// 连续内存视图（C++17 没有 std::span）
+template <typename T>
+struct myColumnSpan {
+    T*     ptr;
+    size_t count;
+
+    T* data() const noexcept { return ptr; }
+    size_t size() const noexcept { return count; }
+    T& operator[](size_t index) const { return ptr[index]; }
+    T* begin() const noexcept { return ptr; }
+    T* end() const noexcept { return ptr + count; }
+};
+
+template <typename... Fields>
+class mySoAVector {
+    static_assert(sizeof...(Fields) > 0, "mySoAVector needs at least one field");
+private:
+    std::tuple<myVector<Fields>...> _columns;   // 每个字段一列
+    using indices = std::index_sequence_for<Fields...>;
+
+public:
+    /* ===== 行代理 ===== */
+    template <bool Const>
+    class basic_row {
+    public:
+        using owner_type = std::conditional_t<Const, const mySoAVector*, mySoAVector*>;
+        basic_row(owner_type owner, size_t index) : _owner(owner), _index(index) {}
+
+        template <size_t I>
+        decltype(auto) get() const { return std::get<I>(_owner->_columns)[_index]; }
+
+        // 整行读出为 tuple（拷贝）
+        std::tuple<Fields...> value() const { return _owner->row_value(_index, indices{}); }
+
+    private:
+        owner_type _owner;
+        size_t _index;
+    };
+    using row_reference = basic_row<false>;
+    using const_row_reference = basic_row<true>;
+
+    // 行迭代器：解引用得到行代理
+    template <bool Const>
+    class basic_iterator {
+    public:
+        using owner_type = std::conditional_t<Const, const mySoAVector*, mySoAVector*>;
+        basic_iterator(owner_type owner, size_t index) : _owner(owner), _index(index) {}
+        basic_row<Const> operator*() const { return basic_row<Const>(_owner, _index); }
+        basic_iterator& operator++() { ++ _index; return *this; }
+        basic_iterator operator++(int) { basic_iterator temp = *this; ++ _index; return temp; }
+        bool operator==(const basic_iterator& other) const { return _index == other._index; }
+        bool operator!=(const basic_iterator& other) const { return _index != other._index; }
+
+    private:
+        owner_type _owner;
+        size_t _index;
+    };
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /* ===== 构造 / 析构 ===== */
+    // 拷贝 / 移动 / 析构均由各列 myVector 完成（零法则）
+    mySoAVector() = default;
+
+    /* ===== 容量相关 ===== */
+    size_t size() const noexcept { return std::get<0>(_columns).size(); }
+    size_t capacity() const noexcept;   // 所有列都无需扩容即可容纳的行数
+    bool empty() const noexcept { return size() == 0; }
+    void reserve(size_t newCapacity);
+    void resize(size_t newSize);
+
+    /* ===== 列访问 ===== */
+    template <size_t I>
+    auto column() noexcept;
+    template <size_t I>
+    auto column() const noexcept;
+
+    /* ===== 行访问 ===== */
+    row_reference operator[](size_t index) { return row_reference(this, index); }
+    const_row_reference operator[](size_t index) const { return const_row_reference(this, index); }
+    row_reference at(size_t index);
+    const_row_reference at(size_t index) const;
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size()); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size()); }
+
+    /* ===== 修改器 ===== */
+    void push_back(const Fields&... values);
+    void pop_back();
+    void clear();
+
+private:
+    /* ===== 内部工具 ===== */
+    void grow_for(size_t required);
+    template <size_t... I>
+    void push_back_impl(std::index_sequence<I...>, const Fields&... values);
+    template <size_t... I>
+    std::tuple<Fields...> row_value(size_t index, std::index_sequence<I...>) const;
+};
+
+
+// ==========================================================
+// Implementation - Capacity
+// ==========================================================
+
+template <typename... Fields>
+size_t mySoAVector<Fields...>::capacity() const noexcept {
+    return std::apply([](const auto&... col) { return std::min({col.capacity()...}); }, _columns);
+}
+
+template <typename... Fields>
+void mySoAVector<Fields...>::reserve(size_t newCapacity) {
+    if (newCapacity <= capacity()) {
+        return;
+    }
+    // 逐列 reserve（容量已足够的列不变）；中途失败时已扩容的列只是容量变大，内容不变
+    std::apply([&](auto&... col) { (col.reserve(newCapacity), ...); }, _columns);
+}
+
+template <typename... Fields>
+void mySoAVector<Fields...>::resize(size_t newSize) {
+    if (newSize > capacity()) {
+        grow_for(newSize);
+    }
+    // 某一列扩大时抛异常：把已经扩大的列缩回原大小，保持各列一致
+    size_t oldSize = size();
+    try {
+        std::apply([&](auto&... col) { (col.resize(newSize), ...); }, _columns);
+    } catch (...) {
+        std::apply([&](auto&... col) { ((col.size() > oldSize ? col.resize(oldSize) : void()), ...); }, _columns);
+        throw;
+    }
+}
+
+// ==========================================================
+// Implementation - Access
+// ==========================================================
+
+template <typename... Fields>
+template <size_t I>
+auto mySoAVector<Fields...>::column() noexcept {
+    auto& col = std::get<I>(_columns);
+    return myColumnSpan<std::remove_reference_t<decltype(col[0])>>{col.begin(), size()};
+}
+
+template <typename... Fields>
+template <size_t I>
+auto mySoAVector<Fields...>::column() const noexcept {
+    const auto& col = std::get<I>(_columns);
+    return myColumnSpan<std::remove_reference_t<decltype(col[0])>>{col.begin(), size()};
+}
+
+template <typename... Fields>
+typename mySoAVector<Fields...>::row_reference mySoAVector<Fields...>::at(size_t index) {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return row_reference(this, index);
+}
+
+template <typename... Fields>
+typename mySoAVector<Fields...>::const_row_reference mySoAVector<Fields...>::at(size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return const_row_reference(this, index);
+}
+
+// ==========================================================
+// Implementation - Modifiers
+// ==========================================================
+
+template <typename... Fields>
+void mySoAVector<Fields...>::push_back(const Fields&... values) {
+    if (size() >= capacity()) {
+        grow_for(size() + 1);
+    }
+    push_back_impl(indices{}, values...);
+}
+
+template <typename... Fields>
+void mySoAVector<Fields...>::pop_back() {
+    if (!empty()) {
+        std::apply([](auto&... col) { (col.pop_back(), ...); }, _columns);
+    }
+}
+
+template <typename... Fields>
+void mySoAVector<Fields...>::clear() {
+    std::apply([](auto&... col) { (col.clear(), ...); }, _columns);
+}
+
+// ==========================================================
+// Implementation - Internal Tools
+// ==========================================================
+
+// 所有列共用一次 myGrowthDoubling 决策，保证容量一致
+template <typename... Fields>
+void mySoAVector<Fields...>::grow_for(size_t required) {
+    reserve(myGrowthDoubling::grow(capacity(), required, (sizeof(Fields) + ...)));
+}
+
+template <typename... Fields>
+template <size_t... I>
+void mySoAVector<Fields...>::push_back_impl(std::index_sequence<I...>, const Fields&... values) {
+    // 容量已预留，逐列追加；第 k 列抛异常时弹出前 k 列刚追加的元素
+    size_t pushed = 0;
+    try {
+        ((std::get<I>(_columns).push_back(values), ++ pushed), ...);
+    } catch (...) {
+        ((I < pushed ? std::get<I>(_columns).pop_back() : void()), ...);
+        throw;
+    }
+}
+
+template <typename... Fields>
+template <size_t... I>
+std::tuple<Fields...> mySoAVector<Fields...>::row_value(size_t index, std::index_sequence<I...>) const {
+    return std::tuple<Fields...>(std::get<I>(_columns)[index]...);
+}
+
+#endif // MY_SOA_VECTOR_H
@@ -0,0 +1,451 @@
+#ifndef MY_STABLE_VECTOR_H
+#define MY_STABLE_VECTOR_H
+
+#include <cstddef>      // size_t, ptrdiff_t
+#include <utility>      // std::move, std::forward
+#include <stdexcept>    // std::out_of_range, std::length_error
+#include <memory>       // std::allocator, std::allocator_traits
+#include <iterator>     // std::random_access_iterator_tag
+#include <type_traits>  // std::conditional_t
+
+#if defined(_MSC_VER)
+#include <intrin.h>     // _BitScanReverse64
+#endif
+
+// ==========================================================
+// myStableVector：分段存储、元素地址永不改变的 vector
+// ==========================================================
+// myVector 扩容时 "举家搬迁"：所有元素被移动、所有指针/引用/迭代器失效，
+// 且单次 push_back 的最坏耗时为 O(N)。myStableVector 改为按几何级数追加新段，
+// 旧段从不移动：
+//
+//  _segments[0] ──► [ B 个元素 ]
+//  _segments[1] ──► [ 2B 个元素        ]
+//  _segments[2] ──► [ 4B 个元素                        ]
+//  ...
+//
+// 第 k 段容量为 B * 2^k（B = 2^FirstBits），前 k 段总容量为 B * (2^k - 1)。
+// 下标 i 的定位只需一次 "最高位" 运算：
+//     j = i + B,  k = highbit(j) - FirstBits,  offset = j - 2^highbit(j)
+//
+// 特性：
+//     - 元素地址稳定：push_back / pop_back 不会使其它元素的指针与引用失效
+//     - push_back 最坏情况只分配一个新段（不拷贝任何元素），没有 O(N) 尖峰
+//     - 代价：内存不连续，operator[] 多一次位运算与一次间接寻址
+
+template <typename T, typename Alloc = std::allocator<T>, size_t FirstBits = 4>
+class myStableVector {
+    static_assert(FirstBits < 32, "first segment too large");
+private:
+    static constexpr size_t first_size = size_t(1) << FirstBits;
+    static constexpr size_t max_segments = sizeof(size_t) * 8 - FirstBits;
+
+    T*      _segments[max_segments];    // 各段起始地址（未分配为 nullptr）
+    size_t  _segmentCount;              // 已分配的段数
+    size_t  _size;                      // 已构造元素个数
+
+public:
+    /* ===== 迭代器 ===== */
+    template <bool Const>
+    class basic_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+        using owner_type = std::conditional_t<Const, const myStableVector*, myStableVector*>;
+
+        basic_iterator() : _owner(nullptr), _index(0) {}
+        basic_iterator(owner_type owner, size_t index) : _owner(owner), _index(index) {}
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& other) : _owner(other._owner), _index(other._index) {}
+
+        reference operator*() const { return (*_owner)[_index]; }
+        pointer operator->() const { return &(*_owner)[_index]; }
+        reference operator[](difference_type n) const { return (*_owner)[_index + n]; }
+        basic_iterator& operator++() { ++ _index; return *this; }
+        basic_iterator operator++(int) { basic_iterator temp = *this; ++ _index; return temp; }
+        basic_iterator& operator--() { -- _index; return *this; }
+        basic_iterator operator--(int) { basic_iterator temp = *this; -- _index; return temp; }
+        basic_iterator& operator+=(difference_type n) { _index += n; return *this; }
+        basic_iterator& operator-=(difference_type n) { _index -= n; return *this; }
+        basic_iterator operator+(difference_type n) const { return basic_iterator(_owner, _index + n); }
+        basic_iterator operator-(difference_type n) const { return basic_iterator(_owner, _index - n); }
+        difference_type operator-(const basic_iterator& other) const { return difference_type(_index) - difference_type(other._index); }
+        bool operator==(const basic_iterator& other) const { return _index == other._index; }
+        bool operator!=(const basic_iterator& other) const { return _index != other._index; }
+        bool operator<(const basic_iterator& other) const { return _index < other._index; }
+        bool operator>(const basic_iterator& other) const { return _index > other._index; }
+        bool operator<=(const basic_iterator& other) const { return _index <= other._index; }
+        bool operator>=(const basic_iterator& other) const { return _index >= other._index; }
+
+    private:
+        friend class myStableVector;
+        template <bool> friend class basic_iterator;
+        owner_type _owner;
+        size_t _index;
+    };
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /* ===== 构造 / 析构 ===== */
+    myStableVector();
+    explicit myStableVector(const Alloc& alloc);
+    ~myStableVector();
+    myStableVector(const myStableVector& other);
+    myStableVector& operator=(const myStableVector& other);
+    myStableVector(myStableVector&& other) noexcept;
+    myStableVector& operator=(myStableVector&& other) noexcept(std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value
+                                                               || std::allocator_traits<Alloc>::is_always_equal::value);
+
+    /* ===== 容量相关 ===== */
+    size_t size() const noexcept;
+    size_t capacity() const noexcept;
+    bool empty() const noexcept;
+    void reserve(size_t newCapacity);
+
+    /* ===== 元素访问 ===== */
+    T& operator[](size_t index);
+    const T& operator[](size_t index) const;
+    T& at(size_t index);
+    const T& at(size_t index) const;
+    T& front();
+    const T& front() const;
+    T& back();
+    const T& back() const;
+
+    /* ===== 迭代器 ===== */
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    /* ===== 修改器 ===== */
+    void push_back(const T& value);
+    void push_back(T&& value);
+    template <typename ... Args>
+    T& emplace_back(Args&& ... args);
+    void pop_back();
+    void clear();
+    void swap(myStableVector& other) noexcept;
+
+private:
+    /* ===== 内部工具 ===== */
+    Alloc allocator;
+    using traits = std::allocator_traits<Alloc>;
+    static size_t high_bit(size_t x) noexcept;
+    static size_t segment_size(size_t k) noexcept;
+    T* slot(size_t index) const noexcept;
+    void add_segment();
+    void release() noexcept;
+    void steal(myStableVector& other) noexcept;     // *this 无段时接管 other 的全部段，other 变为空
+};
+
+
+// ==========================================================
+// Implementation - Constructors / Destructor
+// ==========================================================
+
+template <typename T, typename Alloc, size_t FirstBits>
+myStableVector<T, Alloc, FirstBits>::myStableVector() : _segments{}, _segmentCount(0), _size(0) {}
+
+template <typename T, typename Alloc, size_t FirstBits>
+myStableVector<T, Alloc, FirstBits>::myStableVector(const Alloc& alloc) : _segments{}, _segmentCount(0), _size(0), allocator(alloc) {}
+
+template <typename T, typename Alloc, size_t FirstBits>
+myStableVector<T, Alloc, FirstBits>::~myStableVector() {
+    release();
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+myStableVector<T, Alloc, FirstBits>::myStableVector(const myStableVector& other)
+    : _segments{}, _segmentCount(0), _size(0), allocator(traits::select_on_container_copy_construction(other.allocator)) {
+        try {
+            reserve(other._size);
+            for (size_t i = 0; i < other._size; i ++) {
+                push_back(other[i]);
+            }
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+// 与 myVector 相同：已分配的段直接复用，只在容量不足时追加新段（基本保证）；
+// propagate_on_container_copy_assignment 为真且分配器不相等时，旧段先由旧分配器释放，再换成对方的分配器
+template <typename T, typename Alloc, size_t FirstBits>
+myStableVector<T, Alloc, FirstBits>& myStableVector<T, Alloc, FirstBits>::operator=(const myStableVector& other) {
+    if (this == &other) {
+        return *this;
+    }
+    if constexpr (traits::propagate_on_container_copy_assignment::value) {
+        if (allocator != other.allocator) {
+            release();
+        }
+        allocator = other.allocator;
+    }
+    clear();
+    reserve(other._size);
+    for (size_t i = 0; i < other._size; i ++) {
+        push_back(other[i]);
+    }
+    return *this;
+}
+
+// 移动后 other 是合法的空 vector，可以继续使用；
+// 因此分配器要拷贝而非移动（标准要求移动后的分配器与原值相等，如节点池的 shared_ptr 不能被掏空）
+template <typename T, typename Alloc, size_t FirstBits>
+myStableVector<T, Alloc, FirstBits>::myStableVector(myStableVector&& other) noexcept
+    : _segments{}, _segmentCount(0), _size(0), allocator(other.allocator) {
+        steal(other);
+    }
+
+// 分配器传播或两者相等：释放自己的段，直接接管对方的段；
+// 否则对方的段只能由对方的分配器释放，只能用自己的分配器逐元素移动
+template <typename T, typename Alloc, size_t FirstBits>
+myStableVector<T, Alloc, FirstBits>& myStableVector<T, Alloc, FirstBits>::operator=(myStableVector&& other)
+    noexcept(traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value) {
+    if (this == &other) {
+        return *this;
+    }
+    if constexpr (!traits::propagate_on_container_move_assignment::value && !traits::is_always_equal::value) {
+        if (allocator != other.allocator) {
+            clear();
+            reserve(other._size);
+            for (size_t i = 0; i < other._size; i ++) {
+                push_back(std::move(other[i]));
+            }
+            other.clear();
+            return *this;
+        }
+    }
+    release();
+    if constexpr (traits::propagate_on_container_move_assignment::value) {
+        allocator = other.allocator;
+    }
+    steal(other);
+    return *this;
+}
+
+// ==========================================================
+// Implementation - Capacity
+// ==========================================================
+
+template <typename T, typename Alloc, size_t FirstBits>
+size_t myStableVector<T, Alloc, FirstBits>::size() const noexcept {
+    return _size;
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+size_t myStableVector<T, Alloc, FirstBits>::capacity() const noexcept {
+    return first_size * ((size_t(1) << _segmentCount) - 1);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+bool myStableVector<T, Alloc, FirstBits>::empty() const noexcept {
+    return _size == 0;
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+void myStableVector<T, Alloc, FirstBits>::reserve(size_t newCapacity) {
+    while (capacity() < newCapacity) {
+        add_segment();
+    }
+}
+
+// ==========================================================
+// Implementation - Element Access
+// ==========================================================
+
+template <typename T, typename Alloc, size_t FirstBits>
+T& myStableVector<T, Alloc, FirstBits>::operator[](size_t index) {
+    return *slot(index);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+const T& myStableVector<T, Alloc, FirstBits>::operator[](size_t index) const {
+    return *slot(index);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+T& myStableVector<T, Alloc, FirstBits>::at(size_t index) {
+    if (index >= _size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return *slot(index);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+const T& myStableVector<T, Alloc, FirstBits>::at(size_t index) const {
+    if (index >= _size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return *slot(index);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+T& myStableVector<T, Alloc, FirstBits>::front() {
+    return *slot(0);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+const T& myStableVector<T, Alloc, FirstBits>::front() const {
+    return *slot(0);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+T& myStableVector<T, Alloc, FirstBits>::back() {
+    return *slot(_size - 1);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+const T& myStableVector<T, Alloc, FirstBits>::back() const {
+    return *slot(_size - 1);
+}
+
+// ==========================================================
+// Implementation - Iterators
+// ==========================================================
+
+template <typename T, typename Alloc, size_t FirstBits>
+typename myStableVector<T, Alloc, FirstBits>::iterator myStableVector<T, Alloc, FirstBits>::begin() noexcept {
+    return iterator(this, 0);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+typename myStableVector<T, Alloc, FirstBits>::iterator myStableVector<T, Alloc, FirstBits>::end() noexcept {
+    return iterator(this, _size);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+typename myStableVector<T, Alloc, FirstBits>::const_iterator myStableVector<T, Alloc, FirstBits>::begin() const noexcept {
+    return const_iterator(this, 0);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+typename myStableVector<T, Alloc, FirstBits>::const_iterator myStableVector<T, Alloc, FirstBits>::end() const noexcept {
+    return const_iterator(this, _size);
+}
+
+// ==========================================================
+// Implementation - Modifiers
+// ==========================================================
+
+template <typename T, typename Alloc, size_t FirstBits>
+void myStableVector<T, Alloc, FirstBits>::push_back(const T& value) {
+    emplace_back(value);
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+void myStableVector<T, Alloc, FirstBits>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+template <typename ... Args>
+T& myStableVector<T, Alloc, FirstBits>::emplace_back(Args&& ... args) {
+    // 旧段不会移动，参数引用自身元素时依然有效
+    if (_size >= capacity()) {
+        add_segment();
+    }
+    T* p = slot(_size);
+    traits::construct(allocator, p, std::forward<Args>(args)...);
+    _size ++;
+    return *p;
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+void myStableVector<T, Alloc, FirstBits>::pop_back() {
+    if (_size > 0) {
+        -- _size;
+        traits::destroy(allocator, slot(_size));
+    }
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+void myStableVector<T, Alloc, FirstBits>::clear() {
+    while (_size > 0) {
+        pop_back();
+    }
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+void myStableVector<T, Alloc, FirstBits>::swap(myStableVector& other) noexcept {
+    using std::swap;
+    for (size_t k = 0; k < max_segments; k ++) {
+        swap(_segments[k], other._segments[k]);
+    }
+    swap(_segmentCount, other._segmentCount);
+    swap(_size, other._size);
+    if constexpr (traits::propagate_on_container_swap::value) {
+        swap(allocator, other.allocator);
+    }
+}
+
+// ==========================================================
+// Implementation - Internal Tools
+// ==========================================================
+
+template <typename T, typename Alloc, size_t FirstBits>
+size_t myStableVector<T, Alloc, FirstBits>::high_bit(size_t x) noexcept {
+    // 最高有效位的位置（x > 0）
+#if defined(__GNUC__) || defined(__clang__)
+    return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(static_cast<unsigned long long>(x));
+#elif defined(_MSC_VER) && defined(_WIN64)
+    unsigned long index;
+    _BitScanReverse64(&index, static_cast<unsigned long long>(x));
+    return index;
+#else
+    size_t bit = 0;
+    while (x >>= 1) {
+        bit ++;
+    }
+    return bit;
+#endif
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+size_t myStableVector<T, Alloc, FirstBits>::segment_size(size_t k) noexcept {
+    return first_size << k;
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+T* myStableVector<T, Alloc, FirstBits>::slot(size_t index) const noexcept {
+    size_t j = index + first_size;
+    size_t h = high_bit(j);
+    return _segments[h - FirstBits] + (j - (size_t(1) << h));
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+void myStableVector<T, Alloc, FirstBits>::add_segment() {
+    if (_segmentCount >= max_segments) {
+        throw std::length_error("myStableVector: too many elements");
+    }
+    _segments[_segmentCount] = traits::allocate(allocator, segment_size(_segmentCount));
+    _segmentCount ++;
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+void myStableVector<T, Alloc, FirstBits>::release() noexcept {
+    clear();
+    for (size_t k = 0; k < _segmentCount; k ++) {
+        traits::deallocate(allocator, _segments[k], segment_size(k));
+        _segments[k] = nullptr;
+    }
+    _segmentCount = 0;
+}
+
+template <typename T, typename Alloc, size_t FirstBits>
+void myStableVector<T, Alloc, FirstBits>::steal(myStableVector& other) noexcept {
+    for (size_t k = 0; k < other._segmentCount; k ++) {
+        _segments[k] = other._segments[k];
+        other._segments[k] = nullptr;
+    }
+    _segmentCount = other._segmentCount;
+    _size = other._size;
+    other._segmentCount = 0;
+    other._size = 0;
+}
+
+#endif // MY_STABLE_VECTOR_H
@@ -4,12 +4,46 @@
 #include <cstddef>      // size_t
 #include <utility>      // std::move
 #include <new>          // placement new
-#include <stdexcept>    // std::out_of_range
+#include <stdexcept>    // std::out_of_range, std::length_error
 #include <memory>       // std::allocator, std::allocator_traits
 #include <type_traits>  // std::is_trivially_copyable
-#include <cstring>      // std::memcpy
+#include <cstring>      // std::memcpy, std::memmove
+#include <iterator>     // std::iterator_traits, std::distance
+#include <initializer_list>
+#include <algorithm>    // std::rotate
+#include <functional>   // std::equal_to
+#include "growthPolicy.h"
 
-template <typename T, typename Alloc = std::allocator<T>>
+// 平凡可重定位 (Trivially Relocatable) 萃取：
+// 若为 true，则 "在新位置按字节复制 + 不析构旧对象" 等价于 "移动构造 + 析构旧对象"，
+// 此时元素搬迁可以直接使用 memcpy / memmove。
+// 默认与 std::is_trivially_copyable 一致；对于 std::unique_ptr 包装类这类
+// 仅持有独占指针、搬迁时无需修改自身状态的类型，用户可以显式特化为 true。
+template <typename T>
+struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+// 分配器扩展接口检测：Alloc 是否提供 T* reallocate(T* p, size_t oldN, size_t newN)
+// 提供该接口的分配器（如 myMallocAllocator）可以通过 realloc / mremap 原地扩容
+template <typename Alloc, typename = void>
+struct allocator_has_reallocate : std::false_type {};
+
+template <typename Alloc>
+struct allocator_has_reallocate<Alloc, std::void_t<decltype(std::declval<Alloc&>().reallocate(
+    std::declval<typename std::allocator_traits<Alloc>::pointer>(), size_t(), size_t()))>> : std::true_type {};
+
+template <typename Alloc>
+inline constexpr bool allocator_has_reallocate_v = allocator_has_reallocate<Alloc>::value;
+
+// 仅当 It 至少是输入迭代器时启用区间接口，
+// 避免 insert(pos, 3, 5) 这类整数调用被迭代器模板截胡
+template <typename It>
+using myVector_require_input_iter = std::enable_if_t<
+    std::is_convertible_v<typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>;
+
+template <typename T, typename Alloc = std::allocator<T>, typename GrowthPolicy = myGrowthDoubling>
 class myVector {
 private:
     T*      _data;      // 指向原始内存（不是“数组”）
@@ -19,18 +53,26 @@ private:
 public:
     /* ===== 构造 / 析构 ===== */
     myVector();
+    explicit myVector(const Alloc& alloc);
     ~myVector();
     myVector(const myVector& other);
     myVector& operator=(const myVector& other);
     myVector(myVector&& other) noexcept;
-    myVector& operator=(myVector&& other) noexcept;
+    myVector& operator=(myVector&& other) noexcept(traits::propagate_on_container_move_assignment::value
+                                                   || traits::is_always_equal::value);
+    myVector(std::initializer_list<T> ilist);
 
     /* ===== 容量相关 ===== */
     size_t size() const noexcept;
     size_t capacity() const noexcept;
     bool empty() const noexcept;
+    size_t wasted_bytes() const noexcept;
     void resize(size_t newSize);
     void resize(size_t newSize, const T& value);
+    void resize_default_init(size_t newSize);
+    template <typename Operation>
+    void resize_and_overwrite(size_t newSize, Operation op);
+    void shrink_to_fit();
 
     /* ===== 元素访问 ===== */
     T& operator[](size_t index);
@@ -59,9 +101,27 @@ public:
     void emplace_back(Args&& ... args);
     iterator insert(const_iterator pos, const T& value);
     iterator insert(const_iterator pos, T&& value);
+    iterator insert(const_iterator pos, size_t count, const T& value);
+    template <typename InputIt, typename = myVector_require_input_iter<InputIt>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last);
+    iterator insert(const_iterator pos, std::initializer_list<T> ilist);
+    template <typename InputIt, typename = myVector_require_input_iter<InputIt>>
+    void assign(InputIt first, InputIt last);
+    void assign(std::initializer_list<T> ilist);
+    template <typename Range>
+    void append_range(const Range& range);
     iterator erase(const_iterator pos);
     iterator erase(const_iterator first, const_iterator last);
 
+    /* ===== 批量删除（单趟压实） ===== */
+    template <typename Pred>
+    size_t erase_if(Pred pred);
+    size_t remove(const T& value);
+    template <typename Pred>
+    size_t retain(Pred pred);
+    template <typename BinaryPred = std::equal_to<>>
+    size_t unique(BinaryPred equal = BinaryPred());
+
 private:
     /* ===== 内部工具 ===== */
     Alloc allocator;
@@ -73,12 +133,21 @@ private:
     void construct_at(size_t index, T&& value);
     template <typename ... Args>
     void construct_at(size_t index, Args&& ... args);
+    size_t next_capacity(size_t required) const;
     void reallocate(size_t newCapacity);
+    template <typename Fill>
+    void insert_gap(size_t index, size_t count, Fill fill);
+    template <typename ForwardIt>
+    void construct_range(T* dest, ForwardIt first, size_t count);
+    void construct_fill(T* dest, size_t count, const T& value);
     void destroy_at(size_t index);
     void destroy_range(size_t from, size_t to);
+    template <typename Drop>
+    size_t compact(Drop drop);
 
 public:
     void swap(myVector& other) noexcept;
+    Alloc get_allocator() const;
 };
 
 
@@ -86,17 +155,20 @@ public:
 // Implementation - Constructors / Destructor
 // ==========================================================
 
-template <typename T, typename Alloc>
-myVector<T, Alloc>::myVector() : _data(nullptr), _size(0), _capacity(0) {}
+template <typename T, typename Alloc, typename GrowthPolicy>
+myVector<T, Alloc, GrowthPolicy>::myVector() : _data(nullptr), _size(0), _capacity(0) {}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+myVector<T, Alloc, GrowthPolicy>::myVector(const Alloc& alloc) : _data(nullptr), _size(0), _capacity(0), allocator(alloc) {}
 
-template <typename T, typename Alloc>
-myVector<T, Alloc>::~myVector() {
+template <typename T, typename Alloc, typename GrowthPolicy>
+myVector<T, Alloc, GrowthPolicy>::~myVector() {
     destroy_range(0, _size);
     traits::deallocate(allocator, _data, _capacity);
 }
 
-template <typename T, typename Alloc>
-myVector<T, Alloc>::myVector(const myVector& other)
+template <typename T, typename Alloc, typename GrowthPolicy>
+myVector<T, Alloc, GrowthPolicy>::myVector(const myVector& other)
     : _data(nullptr), _size(0), _capacity(0), allocator(traits::select_on_container_copy_construction(other.allocator)) {
         if (other._size > 0) {
             allocate(other._capacity);
@@ -107,39 +179,98 @@ myVector<T, Alloc>::myVector(const myVector& other)
         _size = other._size;
     }
 
-template <typename T, typename Alloc>
-myVector<T, Alloc>& myVector<T, Alloc>::operator=(const myVector& other) {
-    if (this != &other) {
-        clear();
-        if (other._size > _capacity) {
+// 拷贝赋值尽量复用已有的内存与元素：
+//     - 容量足够：重叠前缀逐个拷贝赋值（std::string 等可复用自身缓冲区），
+//       只对多出的部分拷贝构造、对多余的尾部析构；平凡可拷贝类型整体一次 memcpy
+//     - 容量不足：在恰好 other.size() 大小的新内存上拷贝构造全部元素，
+//       成功后才销毁旧元素、释放旧内存（强保证）
+//     - propagate_on_container_copy_assignment 为真且分配器不相等时，
+//       旧元素与旧内存必须先由旧分配器销毁 / 释放，再换成对方的分配器
+template <typename T, typename Alloc, typename GrowthPolicy>
+myVector<T, Alloc, GrowthPolicy>& myVector<T, Alloc, GrowthPolicy>::operator=(const myVector& other) {
+    if (this == &other) {
+        return *this;
+    }
+    if constexpr (traits::propagate_on_container_copy_assignment::value) {
+        if (allocator != other.allocator) {
+            destroy_range(0, _size);
             traits::deallocate(allocator, _data, _capacity);
-            allocate(other._capacity);
+            _data = nullptr;
+            _size = 0;
+            _capacity = 0;
         }
-        for (size_t i = 0; i < other._size; i ++) {
-            construct_at(i, other._data[i]);
+        allocator = other.allocator;
+    }
+    size_t count = other._size;
+    if (count > _capacity) {
+        T* newData = traits::allocate(allocator, count);
+        try {
+            construct_range(newData, other._data, count);
+        } catch (...) {
+            traits::deallocate(allocator, newData, count);
+            throw;
+        }
+        destroy_range(0, _size);
+        traits::deallocate(allocator, _data, _capacity);
+        _data = newData;
+        _capacity = count;
+    } else if constexpr (std::is_trivially_copyable_v<T>) {
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(_data), static_cast<const void*>(other._data), count * sizeof(T));
+        }
+    } else {
+        size_t common = _size < count ? _size : count;
+        for (size_t i = 0; i < common; i ++) {
+            _data[i] = other._data[i];
+        }
+        if (count > _size) {
+            // 构造失败时 construct_range 已回滚，_size 保持为旧值（基本保证）
+            construct_range(_data + _size, other._data + _size, count - _size);
+        } else {
+            destroy_range(count, _size);
         }
     }
-    _size = other._size;
+    _size = count;
     return *this;
 }
 
-template <typename T, typename Alloc>
-myVector<T, Alloc>::myVector(myVector&& other) noexcept
+template <typename T, typename Alloc, typename GrowthPolicy>
+myVector<T, Alloc, GrowthPolicy>::myVector(myVector&& other) noexcept
     : _data(other._data), _size(other._size), _capacity(other._capacity), allocator(std::move(other.allocator)) {
         other._data = nullptr;
         other._size = 0;
         other._capacity = 0;
     }
 
-template <typename T, typename Alloc>
-myVector<T, Alloc>& myVector<T, Alloc>::operator=(myVector&& other) noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy>
+myVector<T, Alloc, GrowthPolicy>& myVector<T, Alloc, GrowthPolicy>::operator=(myVector&& other)
+    noexcept(traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value) {
     if (this != &other) {
         clear();
+        if constexpr (!traits::propagate_on_container_move_assignment::value && !traits::is_always_equal::value) {
+            // 分配器不传播且两者不相等：对方的内存只能由对方的分配器释放，
+            // 不能直接接管指针，只能用自己的分配器逐元素移动
+            if (allocator != other.allocator) {
+                if (other._size > _capacity) {
+                    T* newData = traits::allocate(allocator, other._size);
+                    traits::deallocate(allocator, _data, _capacity);
+                    _data = newData;
+                    _capacity = other._size;
+                }
+                for (; _size < other._size; _size ++) {
+                    construct_at(_size, std::move(other._data[_size]));
+                }
+                other.clear();
+                return *this;
+            }
+        }
         traits::deallocate(allocator, _data, _capacity);
         _data = other._data;
         _size = other._size;
         _capacity = other._capacity;
-        allocator = std::move(other.allocator);
+        if constexpr (traits::propagate_on_container_move_assignment::value) {
+            allocator = std::move(other.allocator);
+        }
         other._data = nullptr;
         other._size = 0;
         other._capacity = 0;
@@ -147,37 +278,44 @@ myVector<T, Alloc>& myVector<T, Alloc>::operator=(myVector&& other) noexcept {
     return *this;
 }
 
+template <typename T, typename Alloc, typename GrowthPolicy>
+myVector<T, Alloc, GrowthPolicy>::myVector(std::initializer_list<T> ilist) : _data(nullptr), _size(0), _capacity(0) {
+    assign(ilist.begin(), ilist.end());
+}
+
 // ==========================================================
 // Implementation - Capacity
 // ==========================================================
 
-template <typename T, typename Alloc>
-size_t myVector<T, Alloc>::size() const noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy>
+size_t myVector<T, Alloc, GrowthPolicy>::size() const noexcept {
     return _size;
 }
 
-template <typename T, typename Alloc>
-size_t myVector<T, Alloc>::capacity() const noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy>
+size_t myVector<T, Alloc, GrowthPolicy>::capacity() const noexcept {
     return _capacity;
 }
 
-template <typename T, typename Alloc>
-bool myVector<T, Alloc>::empty() const noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy>
+bool myVector<T, Alloc, GrowthPolicy>::empty() const noexcept {
     return _size == 0;
 }
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::resize(size_t newSize) {
+// 已分配但未使用的字节数，用于评估扩容策略的内存开销
+template <typename T, typename Alloc, typename GrowthPolicy>
+size_t myVector<T, Alloc, GrowthPolicy>::wasted_bytes() const noexcept {
+    return (_capacity - _size) * sizeof(T);
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::resize(size_t newSize) {
     if (newSize < _size) {
         destroy_range(newSize, _size);
     }
     else if (newSize > _size) {
         if (newSize > _capacity) {
-            size_t newCapacity = (_capacity == 0) ? 1 : _capacity;
-            while (newCapacity < newSize) {
-                newCapacity *= 2;
-            }
-            reallocate(newCapacity);
+            reallocate(next_capacity(newSize));
         }
         for (size_t i = _size; i < newSize; i ++) {
             construct_at(i);
@@ -186,18 +324,14 @@ void myVector<T, Alloc>::resize(size_t newSize) {
     _size = newSize;
 }
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::resize(size_t newSize, const T& value) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::resize(size_t newSize, const T& value) {
     if (newSize < _size) {
         destroy_range(newSize, _size);
     }
     else if (newSize > _size) {
         if (newSize > _capacity) {
-            size_t newCapacity = (_capacity == 0) ? 1 : _capacity;
-            while (newCapacity < newSize) {
-                newCapacity *= 2;
-            }
-            reallocate(newCapacity);
+            reallocate(next_capacity(newSize));
         }
         for (size_t i = _size; i < newSize; i ++) {
             construct_at(i, value);
@@ -206,53 +340,108 @@ void myVector<T, Alloc>::resize(size_t newSize, const T& value) {
     _size = newSize;
 }
 
+// 与 resize(n) 相同，但新元素采用默认初始化而非值初始化：
+// 对 int / HeavyPOD 这类平凡类型不做清零，适合随后会被整体覆盖的缓冲区
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::resize_default_init(size_t newSize) {
+    if (newSize < _size) {
+        destroy_range(newSize, _size);
+    }
+    else if (newSize > _size) {
+        if (newSize > _capacity) {
+            reallocate(next_capacity(newSize));
+        }
+        if constexpr (!std::is_trivially_default_constructible_v<T>) {
+            for (size_t i = _size; i < newSize; i ++) {
+                ::new (static_cast<void*>(&_data[i])) T;
+            }
+        }
+    }
+    _size = newSize;
+}
+
+// 预留 newSize 个元素的空间，把整块缓冲区交给 op(T* data, size_t newSize)，
+// op 负责写入 [0, r) 并返回实际大小 r (r <= newSize)，随后提交 _size = r。
+// [_size, newSize) 在交给 op 时未初始化，因此仅支持平凡类型。
+// 典型用法：一次 read() / 解码直接写入尾部，无需先清零再覆盖。
+template <typename T, typename Alloc, typename GrowthPolicy>
+template <typename Operation>
+void myVector<T, Alloc, GrowthPolicy>::resize_and_overwrite(size_t newSize, Operation op) {
+    static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+                  "resize_and_overwrite requires a trivial element type");
+    if (newSize > _capacity) {
+        reallocate(next_capacity(newSize));
+    }
+    size_t result = static_cast<size_t>(op(_data, newSize));
+    if (result > newSize) {
+        throw std::length_error("resize_and_overwrite: returned size exceeds requested size");
+    }
+    _size = result;
+}
+
+// 把容量收缩到 size()，归还压实 / 删除后多余的内存；空 vector 直接释放整块内存。
+// 经由 reallocate：支持 reallocate 扩展的分配器可原地收缩，否则 "分配-移动-释放"（强保证）
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::shrink_to_fit() {
+    if (_capacity == _size) {
+        return;
+    }
+    if (_size == 0) {
+        traits::deallocate(allocator, _data, _capacity);
+        _data = nullptr;
+        _capacity = 0;
+        return;
+    }
+    reallocate(_size);
+}
+
 // ==========================================================
 // Implementation - Element Access
 // ==========================================================
 
-template <typename T, typename Alloc>
-T& myVector<T, Alloc>::operator[](size_t index) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+T& myVector<T, Alloc, GrowthPolicy>::operator[](size_t index) {
     return _data[index];
 }
 
-template <typename T, typename Alloc>
-const T& myVector<T, Alloc>::operator[](size_t index) const {
+template <typename T, typename Alloc, typename GrowthPolicy>
+const T& myVector<T, Alloc, GrowthPolicy>::operator[](size_t index) const {
     return _data[index];
 }
 
-template <typename T, typename Alloc>
-T& myVector<T, Alloc>::at(size_t index) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+T& myVector<T, Alloc, GrowthPolicy>::at(size_t index) {
     if (index >= _size) {
         throw std::out_of_range("Index out of range");
     }
     return _data[index];
 }
 
-template <typename T, typename Alloc>
-const T& myVector<T, Alloc>::at(size_t index) const {
+template <typename T, typename Alloc, typename GrowthPolicy>
+const T& myVector<T, Alloc, GrowthPolicy>::at(size_t index) const {
     if (index >= _size) {
         throw std::out_of_range("Index out of range");
     }
     return _data[index];
 }
 
-template <typename T, typename Alloc>
-T& myVector<T, Alloc>::front() {
+template <typename T, typename Alloc, typename GrowthPolicy>
+T& myVector<T, Alloc, GrowthPolicy>::front() {
     return _data[0];
 }
 
-template <typename T, typename Alloc>
-const T& myVector<T, Alloc>::front() const {
+template <typename T, typename Alloc, typename GrowthPolicy>
+const T& myVector<T, Alloc, GrowthPolicy>::front() const {
     return _data[0];
 }
 
-template <typename T, typename Alloc>
-T& myVector<T, Alloc>::back() {
+template <typename T, typename Alloc, typename GrowthPolicy>
+T& myVector<T, Alloc, GrowthPolicy>::back() {
     return _data[_size - 1];
 }
 
-template <typename T, typename Alloc>
-const T& myVector<T, Alloc>::back() const {
+template <typename T, typename Alloc, typename GrowthPolicy>
+const T& myVector<T, Alloc, GrowthPolicy>::back() const {
     return _data[_size - 1];
 }
 
@@ -260,23 +449,23 @@ const T& myVector<T, Alloc>::back() const {
 // Implementation - Iterators
 // ==========================================================
 
-template <typename T, typename Alloc>
-typename myVector<T, Alloc>::iterator myVector<T, Alloc>::begin() noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy>
+typename myVector<T, Alloc, GrowthPolicy>::iterator myVector<T, Alloc, GrowthPolicy>::begin() noexcept {
     return _data;
 }
 
-template <typename T, typename Alloc>
-typename myVector<T, Alloc>::iterator myVector<T, Alloc>::end() noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy>
+typename myVector<T, Alloc, GrowthPolicy>::iterator myVector<T, Alloc, GrowthPolicy>::end() noexcept {
     return _data + _size;
 }
 
-template <typename T, typename Alloc>
-typename myVector<T, Alloc>::const_iterator myVector<T, Alloc>::begin() const noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy>
+typename myVector<T, Alloc, GrowthPolicy>::const_iterator myVector<T, Alloc, GrowthPolicy>::begin() const noexcept {
     return _data;
 }
 
-template <typename T, typename Alloc>
-typename myVector<T, Alloc>::const_iterator myVector<T, Alloc>::end() const noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy>
+typename myVector<T, Alloc, GrowthPolicy>::const_iterator myVector<T, Alloc, GrowthPolicy>::end() const noexcept {
     return _data + _size;
 }
 
@@ -284,51 +473,49 @@ typename myVector<T, Alloc>::const_iterator myVector<T, Alloc>::end() const noex
 // Implementation - Modifiers
 // ==========================================================
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::push_back(const T& value) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::push_back(const T& value) {
     if (_size >= _capacity) {
-        size_t newCapacity = (_capacity == 0) ? 1 : _capacity * 2;
-        reallocate(newCapacity);
+        reallocate(next_capacity(_size + 1));
     }
     construct_at(_size, value);
     _size ++;
 }
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::pop_back() {
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::pop_back() {
     if (_size > 0) {
         -- _size;
         destroy_at(_size);
     }
 }
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::clear() {
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::clear() {
     destroy_range(0, _size);
     _size = 0;
 }
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::reserve(size_t newCapacity) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::reserve(size_t newCapacity) {
     if (newCapacity <= _capacity) {
         return;
     }
     reallocate(newCapacity);
 }
 
-template <typename T, typename Alloc>
+template <typename T, typename Alloc, typename GrowthPolicy>
 template <typename ... Args>
-void myVector<T, Alloc>::emplace_back(Args&& ... args) {
+void myVector<T, Alloc, GrowthPolicy>::emplace_back(Args&& ... args) {
     if (_size >= _capacity) {
-        size_t newCapacity = (_capacity == 0) ? 1 : _capacity * 2;
-        reallocate(newCapacity);
+        reallocate(next_capacity(_size + 1));
     }
     construct_at(_size, std::forward<Args>(args)...);
     _size ++;
 }
 
-template <typename T, typename Alloc>
-typename myVector<T, Alloc>::iterator myVector<T, Alloc>::insert(const_iterator pos, const T& value) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+typename myVector<T, Alloc, GrowthPolicy>::iterator myVector<T, Alloc, GrowthPolicy>::insert(const_iterator pos, const T& value) {
     if (pos < begin() || pos > end()) {
         throw std::out_of_range("Insert position out of range");
     }
@@ -336,43 +523,171 @@ typename myVector<T, Alloc>::iterator myVector<T, Alloc>::insert(const_iterator
     // 当心迭代器失效陷阱 若先 reallocate 则 pos 失效
     // 所以必须先计算 index
     if (_size >= _capacity) {
-        size_t newCapacity = (_capacity == 0) ? 1 : _capacity * 2;
-        reallocate(newCapacity);
+        reallocate(next_capacity(_size + 1));
     }
-    for (size_t i = _size; i > index; i --) {
-        construct_at(i, std::move(_data[i - 1]));
-        destroy_at(i - 1);
+    if constexpr (is_trivially_relocatable_v<T>) {
+        // 整体右移一格，若构造失败则整体移回，保持原状
+        std::memmove(static_cast<void*>(_data + index + 1), static_cast<const void*>(_data + index), (_size - index) * sizeof(T));
+        try {
+            construct_at(index, value);
+        } catch (...) {
+            std::memmove(static_cast<void*>(_data + index), static_cast<const void*>(_data + index + 1), (_size - index) * sizeof(T));
+            throw;
+        }
+    } else {
+        for (size_t i = _size; i > index; i --) {
+            construct_at(i, std::move(_data[i - 1]));
+            destroy_at(i - 1);
+        }
+        construct_at(index, value);
     }
-    construct_at(index, value);
     _size ++;
     return begin() + index;
 }
 
-template <typename T, typename Alloc>
-typename myVector<T, Alloc>::iterator myVector<T, Alloc>::insert(const_iterator pos, T&& value) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+typename myVector<T, Alloc, GrowthPolicy>::iterator myVector<T, Alloc, GrowthPolicy>::insert(const_iterator pos, T&& value) {
     if (pos < begin() || pos > end()) {
         throw std::out_of_range("Insert position out of range");
     }
     size_t index = pos - begin();
     if (_size >= _capacity) {
-        size_t newCapacity = (_capacity == 0) ? 1 : _capacity * 2;
-        reallocate(newCapacity);
+        reallocate(next_capacity(_size + 1));
     }
-    for (size_t i = _size; i > index; i --) {
-        construct_at(i, std::move(_data[i - 1]));
-        destroy_at(i - 1);
+    if constexpr (is_trivially_relocatable_v<T>) {
+        // 整体右移一格，若构造失败则整体移回，保持原状
+        std::memmove(static_cast<void*>(_data + index + 1), static_cast<const void*>(_data + index), (_size - index) * sizeof(T));
+        try {
+            construct_at(index, std::move(value));
+        } catch (...) {
+            std::memmove(static_cast<void*>(_data + index), static_cast<const void*>(_data + index + 1), (_size - index) * sizeof(T));
+            throw;
+        }
+    } else {
+        for (size_t i = _size; i > index; i --) {
+            construct_at(i, std::move(_data[i - 1]));
+            destroy_at(i - 1);
+        }
+        construct_at(index, std::move(value));
     }
-    construct_at(index, std::move(value));
     _size ++;
     return begin() + index;
 }
 
-template <typename T, typename Alloc>
-typename myVector<T, Alloc>::iterator myVector<T, Alloc>::erase(const_iterator pos) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+typename myVector<T, Alloc, GrowthPolicy>::iterator myVector<T, Alloc, GrowthPolicy>::insert(const_iterator pos, size_t count, const T& value) {
+    if (pos < begin() || pos > end()) {
+        throw std::out_of_range("Insert position out of range");
+    }
+    size_t index = pos - begin();
+    const T* src = std::addressof(value);
+    if (src >= _data && src < _data + _size) {
+        // value 指向自身元素：扩容或搬移后会失效，先复制一份
+        T copy(value);
+        return insert(pos, count, copy);
+    }
+    insert_gap(index, count, [&](T* dest) { construct_fill(dest, count, value); });
+    return begin() + index;
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+template <typename InputIt, typename>
+typename myVector<T, Alloc, GrowthPolicy>::iterator myVector<T, Alloc, GrowthPolicy>::insert(const_iterator pos, InputIt first, InputIt last) {
+    if (pos < begin() || pos > end()) {
+        throw std::out_of_range("Insert position out of range");
+    }
+    size_t index = pos - begin();
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_convertible_v<category, std::forward_iterator_tag>) {
+        // 前向迭代器：先求出区间长度，至多扩容一次
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        if constexpr (std::is_pointer_v<InputIt>) {
+            if (count > 0 && first < _data + _size && last > _data) {
+                // 区间来自自身：腾位时尾部会被搬移或扩容释放，先复制到临时 vector
+                myVector temp(allocator);
+                temp.assign(first, last);
+                return insert(pos, temp.begin(), temp.end());
+            }
+        }
+        insert_gap(index, count, [&](T* dest) { construct_range(dest, first, count); });
+    } else {
+        // 输入迭代器只能遍历一次：先追加到尾部，再旋转到插入位置
+        size_t oldSize = _size;
+        try {
+            for (; first != last; ++ first) {
+                emplace_back(*first);
+            }
+        } catch (...) {
+            destroy_range(oldSize, _size);
+            _size = oldSize;
+            throw;
+        }
+        std::rotate(_data + index, _data + oldSize, _data + _size);
+    }
+    return begin() + index;
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+typename myVector<T, Alloc, GrowthPolicy>::iterator myVector<T, Alloc, GrowthPolicy>::insert(const_iterator pos, std::initializer_list<T> ilist) {
+    return insert(pos, ilist.begin(), ilist.end());
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+template <typename InputIt, typename>
+void myVector<T, Alloc, GrowthPolicy>::assign(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_convertible_v<category, std::forward_iterator_tag>) {
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        if (count > _capacity) {
+            // 先在新内存上构造，成功后再释放旧资源（强保证）
+            T* newData = traits::allocate(allocator, count);
+            try {
+                construct_range(newData, first, count);
+            } catch (...) {
+                traits::deallocate(allocator, newData, count);
+                throw;
+            }
+            destroy_range(0, _size);
+            traits::deallocate(allocator, _data, _capacity);
+            _data = newData;
+            _capacity = count;
+        } else {
+            clear();
+            construct_range(_data, first, count);
+        }
+        _size = count;
+    } else {
+        clear();
+        for (; first != last; ++ first) {
+            emplace_back(*first);
+        }
+    }
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::assign(std::initializer_list<T> ilist) {
+    assign(ilist.begin(), ilist.end());
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+template <typename Range>
+void myVector<T, Alloc, GrowthPolicy>::append_range(const Range& range) {
+    insert(end(), std::begin(range), std::end(range));
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+typename myVector<T, Alloc, GrowthPolicy>::iterator myVector<T, Alloc, GrowthPolicy>::erase(const_iterator pos) {
     if (pos < begin() || pos >= end()) {
         throw std::out_of_range("Erase position out of range");
     }
     size_t index = pos - begin();
+    if constexpr (is_trivially_relocatable_v<T>) {
+        // 先销毁被删除元素，再把尾部整体左移一格
+        destroy_at(index);
+        std::memmove(static_cast<void*>(_data + index), static_cast<const void*>(_data + index + 1), (_size - index - 1) * sizeof(T));
+        _size --;
+        return begin() + index;
+    }
     for (size_t i = index; i < _size; i ++) {
         if (i + 1 < _size) {
             _data[i] = std::move(_data[i + 1]);
@@ -383,12 +698,18 @@ typename myVector<T, Alloc>::iterator myVector<T, Alloc>::erase(const_iterator p
     return begin() + index;
 }
 
-template <typename T, typename Alloc>
-typename myVector<T, Alloc>::iterator myVector<T, Alloc>::erase(const_iterator first, const_iterator last) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+typename myVector<T, Alloc, GrowthPolicy>::iterator myVector<T, Alloc, GrowthPolicy>::erase(const_iterator first, const_iterator last) {
     if (first < begin() || last > end() || first > last) {
         throw std::out_of_range("Erase range out of range");
     }
     size_t startIndex = first - begin(), endIndex = last - begin();
+    if constexpr (is_trivially_relocatable_v<T>) {
+        destroy_range(startIndex, endIndex);
+        std::memmove(static_cast<void*>(_data + startIndex), static_cast<const void*>(_data + endIndex), (_size - endIndex) * sizeof(T));
+        _size -= endIndex - startIndex;
+        return begin() + startIndex;
+    }
     for (size_t i = startIndex; i < _size; i ++) {
         if (i + (endIndex - startIndex) < _size) {
             _data[i] = std::move(_data[i + (endIndex - startIndex)]);
@@ -402,48 +723,102 @@ typename myVector<T, Alloc>::iterator myVector<T, Alloc>::erase(const_iterator f
     return begin() + startIndex;
 }
 
+// ==========================================================
+// Implementation - Bulk Erase
+// ==========================================================
+// 反复调用 erase(pos) 每次都要搬移整个尾部，过滤 N 个元素是 O(N^2)；
+// 以下接口都经由 compact 单趟完成，每个保留元素至多搬移一次，返回删除的元素个数。
+
+// 删除所有满足 pred(x) 的元素
+template <typename T, typename Alloc, typename GrowthPolicy>
+template <typename Pred>
+size_t myVector<T, Alloc, GrowthPolicy>::erase_if(Pred pred) {
+    return compact([&pred](const T*, const T& x) { return static_cast<bool>(pred(x)); });
+}
+
+// 删除所有等于 value 的元素
+template <typename T, typename Alloc, typename GrowthPolicy>
+size_t myVector<T, Alloc, GrowthPolicy>::remove(const T& value) {
+    // value 可能引用本 vector 中的元素，先复制一份，避免它被搬移覆盖后比较结果改变
+    const T copy = value;
+    return compact([&copy](const T*, const T& x) { return x == copy; });
+}
+
+// 只保留满足 pred(x) 的元素（erase_if 的反面）
+template <typename T, typename Alloc, typename GrowthPolicy>
+template <typename Pred>
+size_t myVector<T, Alloc, GrowthPolicy>::retain(Pred pred) {
+    return compact([&pred](const T*, const T& x) { return !pred(x); });
+}
+
+// 每组相邻的等价元素只保留第一个；equal(prev, x) 中 prev 为上一个保留的元素
+template <typename T, typename Alloc, typename GrowthPolicy>
+template <typename BinaryPred>
+size_t myVector<T, Alloc, GrowthPolicy>::unique(BinaryPred equal) {
+    return compact([&equal](const T* prev, const T& x) { return prev != nullptr && static_cast<bool>(equal(*prev, x)); });
+}
+
 // ==========================================================
 // Implementation - Internal Tools
 // ==========================================================
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::allocate(size_t n) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::allocate(size_t n) {
     // allocate 仅适用于空 vector
     _data = traits::allocate(allocator, n);
     _capacity = n;
 }
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::construct_at(size_t index) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::construct_at(size_t index) {
     traits::construct(allocator, &_data[index]);
 }
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::construct_at(size_t index, const T& value) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::construct_at(size_t index, const T& value) {
     traits::construct(allocator, &_data[index], value);
 }
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::construct_at(size_t index, T&& value) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::construct_at(size_t index, T&& value) {
     traits::construct(allocator, &_data[index], std::move(value));
 }
 
-template <typename T, typename Alloc>
+template <typename T, typename Alloc, typename GrowthPolicy>
 template <typename ... Args>
-void myVector<T, Alloc>::construct_at(size_t index, Args&& ... args) {
+void myVector<T, Alloc, GrowthPolicy>::construct_at(size_t index, Args&& ... args) {
     traits::construct(allocator, &_data[index], std::forward<Args>(args)...);
 }
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::reallocate(size_t newCapacity) {
+// 所有自动扩容都经由此处询问 GrowthPolicy
+template <typename T, typename Alloc, typename GrowthPolicy>
+size_t myVector<T, Alloc, GrowthPolicy>::next_capacity(size_t required) const {
+    size_t newCapacity = GrowthPolicy::grow(_capacity, required, sizeof(T));
+    return newCapacity < required ? required : newCapacity;
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::reallocate(size_t newCapacity) {
+    // 0. 分配器支持原地扩容时，可重定位元素直接交给它（realloc / mremap），
+    //    无需新旧两块内存并存，也无需逐字节拷贝；失败时分配器抛出异常且原内存不变
+    if constexpr (is_trivially_relocatable_v<T> && allocator_has_reallocate_v<Alloc>) {
+        if (_data != nullptr) {
+            _data = allocator.reallocate(_data, _capacity, newCapacity);
+            _capacity = newCapacity;
+            return;
+        }
+    }
+
     // 1. 分配新内存
     T* newData = traits::allocate(allocator, newCapacity); 
     
     // 2. 尝试在新内存上构造元素
     // 性能优化
-    // 编译器分支(C++17)：如果 T 是 trivially copyable 的，则直接 memcpy；否则逐个 move 构造
-    if constexpr (std::is_trivially_copyable_v<T>) {
-        std::memcpy(newData, _data, _size * sizeof(T));
+    // 编译器分支(C++17)：如果 T 是 trivially relocatable 的，则直接 memcpy；否则逐个 move 构造
+    if constexpr (is_trivially_relocatable_v<T>) {
+        if (_size > 0) {
+            std::memcpy(static_cast<void*>(newData), static_cast<const void*>(_data), _size * sizeof(T));
+        }
     } else {
         size_t i = 0;
         try {
@@ -460,9 +835,11 @@ void myVector<T, Alloc>::reallocate(size_t newCapacity) {
         }
     }
 
-    // 3. 释放旧资源
-    for (size_t k = 0; k < _size; k ++) {
-        traits::destroy(allocator, &_data[k]);
+    // 3. 释放旧资源（已按字节重定位的元素不再析构旧副本）
+    if constexpr (!is_trivially_relocatable_v<T>) {
+        for (size_t k = 0; k < _size; k ++) {
+            traits::destroy(allocator, &_data[k]);
+        }
     }
     traits::deallocate(allocator, _data, _capacity);
 
@@ -471,25 +848,214 @@ void myVector<T, Alloc>::reallocate(size_t newCapacity) {
     _capacity = newCapacity;
 }
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::swap(myVector& other) noexcept {
+// 在 index 处腾出 count 个未构造的空位，并调用 fill(dest) 在空位上构造新元素
+// fill 需自行保证：抛异常时已构造的部分全部销毁
+// 容量不足时只扩容一次，新元素直接构造在新内存上，旧数据在成功后才迁移（强保证）
+template <typename T, typename Alloc, typename GrowthPolicy>
+template <typename Fill>
+void myVector<T, Alloc, GrowthPolicy>::insert_gap(size_t index, size_t count, Fill fill) {
+    if (count == 0) {
+        return;
+    }
+    if (_size + count > _capacity) {
+        size_t newCapacity = next_capacity(_size + count);
+        T* newData = traits::allocate(allocator, newCapacity);
+        try {
+            fill(newData + index);
+        } catch (...) {
+            traits::deallocate(allocator, newData, newCapacity);
+            throw;
+        }
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if (_size > 0) {
+                std::memcpy(static_cast<void*>(newData), static_cast<const void*>(_data), index * sizeof(T));
+                std::memcpy(static_cast<void*>(newData + index + count), static_cast<const void*>(_data + index), (_size - index) * sizeof(T));
+            }
+        } else {
+            size_t i = 0, j = index;
+            try {
+                for (; i < index; i ++) {
+                    traits::construct(allocator, &newData[i], std::move_if_noexcept(_data[i]));
+                }
+                for (; j < _size; j ++) {
+                    traits::construct(allocator, &newData[j + count], std::move_if_noexcept(_data[j]));
+                }
+            } catch (...) {
+                for (size_t k = 0; k < i; k ++) {
+                    traits::destroy(allocator, &newData[k]);
+                }
+                for (size_t k = index; k < j + count; k ++) {
+                    traits::destroy(allocator, &newData[k]);
+                }
+                traits::deallocate(allocator, newData, newCapacity);
+                throw;
+            }
+            destroy_range(0, _size);
+        }
+        traits::deallocate(allocator, _data, _capacity);
+        _data = newData;
+        _capacity = newCapacity;
+    } else if constexpr (is_trivially_relocatable_v<T>) {
+        // 尾部整体右移 count 格；构造失败则移回
+        std::memmove(static_cast<void*>(_data + index + count), static_cast<const void*>(_data + index), (_size - index) * sizeof(T));
+        try {
+            fill(_data + index);
+        } catch (...) {
+            std::memmove(static_cast<void*>(_data + index), static_cast<const void*>(_data + index + count), (_size - index) * sizeof(T));
+            throw;
+        }
+    } else {
+        // 非可重定位类型：先在尾部构造，再旋转到 index（旋转只用移动操作）
+        fill(_data + _size);
+        std::rotate(_data + index, _data + _size, _data + _size + count);
+    }
+    _size += count;
+}
+
+// 在未构造内存 [dest, dest + count) 上按区间拷贝构造；抛异常时回滚已构造部分
+template <typename T, typename Alloc, typename GrowthPolicy>
+template <typename ForwardIt>
+void myVector<T, Alloc, GrowthPolicy>::construct_range(T* dest, ForwardIt first, size_t count) {
+    using source = std::remove_cv_t<std::remove_pointer_t<ForwardIt>>;
+    if constexpr (std::is_trivially_copyable_v<T> && std::is_pointer_v<ForwardIt> && std::is_same_v<source, T>) {
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), count * sizeof(T));
+        }
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < count; i ++, ++ first) {
+                traits::construct(allocator, &dest[i], *first);
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; j ++) {
+                traits::destroy(allocator, &dest[j]);
+            }
+            throw;
+        }
+    }
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::construct_fill(T* dest, size_t count, const T& value) {
+    size_t i = 0;
+    try {
+        for (; i < count; i ++) {
+            traits::construct(allocator, &dest[i], value);
+        }
+    } catch (...) {
+        for (size_t j = 0; j < i; j ++) {
+            traits::destroy(allocator, &dest[j]);
+        }
+        throw;
+    }
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::swap(myVector& other) noexcept {
     using std::swap;
     swap(_data, other._data);
     swap(_size, other._size);
     swap(_capacity, other._capacity);
-    swap(allocator, other.allocator);
+    // 仅在 propagate_on_container_swap 时交换分配器；否则两者必须相等（标准要求）
+    if constexpr (traits::propagate_on_container_swap::value) {
+        swap(allocator, other.allocator);
+    }
 }
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::destroy_at(size_t index) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+Alloc myVector<T, Alloc, GrowthPolicy>::get_allocator() const {
+    return allocator;
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::destroy_at(size_t index) {
     traits::destroy(allocator, &_data[index]);
 }
 
-template <typename T, typename Alloc>
-void myVector<T, Alloc>::destroy_range(size_t from, size_t to) {
+template <typename T, typename Alloc, typename GrowthPolicy>
+void myVector<T, Alloc, GrowthPolicy>::destroy_range(size_t from, size_t to) {
     for (size_t i = from; i < to; i ++) {
         destroy_at(i);
     }
 }
 
+// 单趟压实：drop(prev, x) 返回 true 的元素被删除，prev 指向上一个保留的元素（尚无时为 nullptr）
+//     - 可重定位类型：被删元素就地析构，连续的保留段 (run) 用一次 memmove 整段左移；
+//       一个元素都不删时不搬移任何字节
+//     - 其它类型：保留元素逐个移动赋值到前面，最后对尾部统一 destroy_range 一次
+// drop 抛异常时把尚未处理的元素接到已保留部分之后，vector 仍然完整有效（基本保证）
+template <typename T, typename Alloc, typename GrowthPolicy>
+template <typename Drop>
+size_t myVector<T, Alloc, GrowthPolicy>::compact(Drop drop) {
+    size_t oldSize = _size;
+    size_t out = 0;
+    if constexpr (is_trivially_relocatable_v<T>) {
+        // [0, out) 已压实；[out, run) 为空洞；[run, i) 为尚未搬移的保留段
+        size_t run = 0;
+        auto flush = [&](size_t to) {
+            if (out != run && to > run) {
+                std::memmove(static_cast<void*>(_data + out), static_cast<const void*>(_data + run), (to - run) * sizeof(T));
+            }
+            out += to - run;
+        };
+        try {
+            for (size_t i = 0; i < _size; i ++) {
+                const T* prev = i > run ? &_data[i - 1] : (out > 0 ? &_data[out - 1] : nullptr);
+                if (drop(prev, _data[i])) {
+                    flush(i);
+                    destroy_at(i);
+                    run = i + 1;
+                }
+            }
+        } catch (...) {
+            flush(_size);
+            _size = out;
+            throw;
+        }
+        flush(_size);
+        _size = out;
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < _size; i ++) {
+                const T* prev = out > 0 ? &_data[out - 1] : nullptr;
+                if (!drop(prev, _data[i])) {
+                    if (out != i) {
+                        _data[out] = std::move(_data[i]);
+                    }
+                    out ++;
+                }
+            }
+        } catch (...) {
+            for (; i < _size; i ++, out ++) {
+                if (out != i) {
+                    _data[out] = std::move(_data[i]);
+                }
+            }
+            destroy_range(out, _size);
+            _size = out;
+            throw;
+        }
+        destroy_range(out, _size);
+        _size = out;
+    }
+    return oldSize - _size;
+}
+
+// ==========================================================
+// Non-member functions
+// ==========================================================
+
+// 与 C++20 std::erase / std::erase_if 同名同义的自由函数版本
+template <typename T, typename Alloc, typename GrowthPolicy, typename Pred>
+size_t erase_if(myVector<T, Alloc, GrowthPolicy>& v, Pred pred) {
+    return v.erase_if(pred);
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy>
+size_t erase(myVector<T, Alloc, GrowthPolicy>& v, const T& value) {
+    return v.remove(value);
+}
+
 #endif // MY_VECTOR_H
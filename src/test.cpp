@@ -1,10 +1,27 @@
+// 构建（在 src 目录下）：除 intVector 的两个实现文件外，其余模块均为头文件
+//     g++ -std=c++17 -O2 -pthread test.cpp myVector/intVector/intVector.cpp myVector/intVector/intVectorSimd.cpp
 #include <iostream>
 #include "test.h"
 
 // 引入各个模块的测试套件
 #include "test/test_myVector.hpp"
+#include "test/test_mySmallVector.hpp"
+#include "test/test_myAllocator.hpp"
+#include "test/test_myMappedVector.hpp"
+#include "test/test_myStableVector.hpp"
+#include "test/test_myConcurrentVector.hpp"
+#include "test/test_mySoAVector.hpp"
+#include "test/test_myBitVector.hpp"
+#include "test/test_intVector.hpp"
+#include "test/test_mySort.hpp"
+#include "test/test_myCompressedIntVector.hpp"
+#include "test/test_myFlatMap.hpp"
+#include "test/test_myStaticSearch.hpp"
+#include "test/test_myParallel.hpp"
 #include "test/test_intList.hpp"
 #include "test/test_myList.hpp"
+#include "test/test_myUnrolledList.hpp"
+#include "test/test_myIntrusiveList.hpp"
 
 int main() {
     std::cout << "==========================================\n";
@@ -10,6 +10,7 @@
 #include <iomanip>
 #include <cstdlib>
 #include <ctime>
+#include <new>
 
 // ==========================================
 // 简易测试框架 (MiniUnit)
@@ -185,21 +186,37 @@ namespace TestHelpers {
         DebugAllocator() = default;
         template <typename U> DebugAllocator(const DebugAllocator<U>&) {}
 
+        static int realloc_count;   // 调用 reallocate 扩展接口的次数（即避免的 "分配-拷贝-释放" 次数）
+        static int inplace_count;   // 其中地址未变、真正原地扩展的次数
+
+        // 使用 malloc/free 作为底层，使 reallocate 扩展接口可以直接交给 realloc
         T* allocate(std::size_t n) {
             alloc_count++;
             // std::cout << "[Alloc] " << n << " elements\n";
-            return std::allocator<T>{}.allocate(n);
+            void* p = std::malloc(n == 0 ? 1 : n * sizeof(T));
+            if (p == nullptr) throw std::bad_alloc();
+            return static_cast<T*>(p);
         }
 
-        void deallocate(T* p, std::size_t n) {
+        void deallocate(T* p, std::size_t /*n*/) {
             dealloc_count++;
             // std::cout << "[Dealloc] " << n << " elements\n";
-            std::allocator<T>{}.deallocate(p, n);
+            std::free(p);
+        }
+
+        T* reallocate(T* p, std::size_t /*oldN*/, std::size_t newN) {
+            realloc_count++;
+            void* q = std::realloc(p, newN == 0 ? 1 : newN * sizeof(T));
+            if (q == nullptr) throw std::bad_alloc();
+            if (q == p) inplace_count++;
+            return static_cast<T*>(q);
         }
     };
 
     template <typename T> int DebugAllocator<T>::alloc_count = 0;
     template <typename T> int DebugAllocator<T>::dealloc_count = 0;
+    template <typename T> int DebugAllocator<T>::realloc_count = 0;
+    template <typename T> int DebugAllocator<T>::inplace_count = 0;
 
     template <typename T, typename U>
     bool operator==(const DebugAllocator<T>&, const DebugAllocator<U>&) { return true; }
@@ -0,0 +1,166 @@
+#ifndef TEST_INTVECTOR_HPP
+#define TEST_INTVECTOR_HPP
+
+#include "../test.h"
+// intVector 是 .h / .cpp 分离实现：这里只包含头文件，两个 .cpp 作为独立的编译单元参与链接（见 test.cpp）
+#include "../myVector/intVector/intVector.h"
+#include "../myVector/intVector/intVectorSimd.h"
+#include <random>
+
+using namespace TestHelpers;
+
+namespace {
+    const char* simd_level_name(intKernels::SimdLevel level) {
+        switch (level) {
+            case intKernels::SimdLevel::AVX2:  return "AVX2";
+            case intKernels::SimdLevel::SSE41: return "SSE4.1";
+            default:                           return "Scalar";
+        }
+    }
+
+    intVector random_ints(size_t n, int lo, int hi, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> dist(lo, hi);
+        intVector v;
+        v.reserve(n);
+        for (size_t i = 0; i < n; ++i) v.push_back(dist(rng));
+        return v;
+    }
+}
+
+TEST(IntVectorSimdTest, AllLevelsMatchScalar) {
+    using intKernels::SimdLevel;
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE41, SimdLevel::AVX2 };
+    // 覆盖空向量、不足一个寄存器、以及带尾部余数的长度
+    const size_t sizes[] = { 0, 1, 3, 7, 8, 9, 31, 1000, 4099 };
+    bool allMatch = true;
+
+    for (SimdLevel level : levels) {
+        intKernels::set_level(level);
+        for (size_t n : sizes) {
+            intVector v = random_ints(n, -1000, 1000, static_cast<unsigned>(n));
+            // 朴素参照
+            long long refSum = 0;
+            size_t refCount = 0, refFind = n;
+            for (size_t i = 0; i < n; ++i) {
+                refSum += v[i];
+                if (v[i] == 7) { ++refCount; if (refFind == n) refFind = i; }
+            }
+            allMatch = allMatch && intKernels::sum(v) == refSum;
+            allMatch = allMatch && intKernels::count(v, 7) == refCount;
+            allMatch = allMatch && intKernels::find(v, 7) == refFind;
+            if (n > 0) {
+                int refMin = v[0], refMax = v[0];
+                for (size_t i = 1; i < n; ++i) { refMin = std::min(refMin, v[i]); refMax = std::max(refMax, v[i]); }
+                allMatch = allMatch && intKernels::min_value(v) == refMin && intKernels::max_value(v) == refMax;
+            }
+
+            intVector filtered;
+            intKernels::filter(v, -10, 500, filtered);
+            size_t k = 0;
+            for (size_t i = 0; i < n; ++i) {
+                if (v[i] >= -10 && v[i] <= 500) allMatch = allMatch && k < filtered.size() && filtered[k++] == v[i];
+            }
+            allMatch = allMatch && k == filtered.size();
+
+            intVector w = v;
+            intKernels::scale(w, 3);
+            intKernels::add(w, v);                          // w = 4v
+            intKernels::prefix_sum(w);
+            int running = 0;
+            for (size_t i = 0; i < n; ++i) {
+                running += 4 * v[i];
+                allMatch = allMatch && w[i] == running;
+            }
+        }
+    }
+    intKernels::set_level(intKernels::detected_level());
+    EXPECT_TRUE(allMatch);
+
+    intVector empty;
+    bool thrown = false;
+    try {
+        intKernels::min_value(empty);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+    intVector a(4), b(5);
+    thrown = false;
+    try {
+        intKernels::add(a, b);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+
+    // 原地过滤
+    intVector self = random_ints(100, 0, 9, 1);
+    size_t evens = 0;
+    for (size_t i = 0; i < self.size(); ++i) evens += (self[i] <= 4);
+    intKernels::filter(self, 0, 4, self);
+    EXPECT_EQ(self.size(), evens);
+}
+
+TEST(IntVectorSimdTest, PerformanceKernels) {
+    std::cout << "    [Perf] intKernels dispatch: " << simd_level_name(intKernels::detected_level()) << "\n";
+    auto us = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count(); };
+    const size_t sizes[] = { 1000000, 16000000 };
+    for (size_t n : sizes) {
+        intVector v = random_ints(n, -1000000, 1000000, 99);
+        intVector out;
+
+        // sum
+        auto t0 = std::chrono::high_resolution_clock::now();
+        long long s = 0;
+        for (size_t i = 0; i < n; ++i) s += v[i];
+        auto t1 = std::chrono::high_resolution_clock::now();
+        long long fast = intKernels::sum(v);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        EXPECT_EQ(s, fast);
+        std::cout << "    [Perf] n=" << n << " sum: naive " << us(t0, t1) << "us, simd " << us(t1, t2) << "us\n";
+
+        // count
+        t0 = std::chrono::high_resolution_clock::now();
+        size_t c = 0;
+        for (size_t i = 0; i < n; ++i) c += (v[i] == 12345);
+        t1 = std::chrono::high_resolution_clock::now();
+        size_t fastCount = intKernels::count(v, 12345);
+        t2 = std::chrono::high_resolution_clock::now();
+        EXPECT_EQ(c, fastCount);
+        std::cout << "    [Perf] n=" << n << " count: naive " << us(t0, t1) << "us, simd " << us(t1, t2) << "us\n";
+
+        // min
+        t0 = std::chrono::high_resolution_clock::now();
+        int m = v[0];
+        for (size_t i = 1; i < n; ++i) if (v[i] < m) m = v[i];
+        t1 = std::chrono::high_resolution_clock::now();
+        int fastMin = intKernels::min_value(v);
+        t2 = std::chrono::high_resolution_clock::now();
+        EXPECT_EQ(m, fastMin);
+        std::cout << "    [Perf] n=" << n << " min: naive " << us(t0, t1) << "us, simd " << us(t1, t2) << "us\n";
+
+        // prefix sum
+        intVector p1 = v, p2 = v;
+        t0 = std::chrono::high_resolution_clock::now();
+        for (size_t i = 1; i < n; ++i) p1[i] = static_cast<int>(static_cast<unsigned>(p1[i]) + static_cast<unsigned>(p1[i - 1]));
+        t1 = std::chrono::high_resolution_clock::now();
+        intKernels::prefix_sum(p2);
+        t2 = std::chrono::high_resolution_clock::now();
+        EXPECT_EQ(p1.back(), p2.back());
+        std::cout << "    [Perf] n=" << n << " prefix_sum: naive " << us(t0, t1) << "us, simd " << us(t1, t2) << "us\n";
+
+        // filter（约 50% 命中，朴素分支难以预测）
+        t0 = std::chrono::high_resolution_clock::now();
+        out.clear();
+        for (size_t i = 0; i < n; ++i) if (v[i] >= 0) out.push_back(v[i]);
+        t1 = std::chrono::high_resolution_clock::now();
+        intVector fastOut;
+        intKernels::filter(v, 0, 2147483647, fastOut);
+        t2 = std::chrono::high_resolution_clock::now();
+        EXPECT_EQ(out.size(), fastOut.size());
+        std::cout << "    [Perf] n=" << n << " filter: naive " << us(t0, t1) << "us, simd " << us(t1, t2) << "us\n";
+    }
+}
+
+#endif // TEST_INTVECTOR_HPP
@@ -0,0 +1,161 @@
+#ifndef TEST_MYALLOCATOR_HPP
+#define TEST_MYALLOCATOR_HPP
+
+#include "../test.h"
+#include "../myVector/myVector.h"
+#include "../myAllocator/myArenaAllocator.h"
+#include "../myAllocator/myHugePageAllocator.h"
+#include "../myAllocator/myPoolAllocator.h"
+#include <cstdint>
+
+using namespace TestHelpers;
+
+TEST(MyAllocatorTest, ArenaPropagates) {
+    myArena arenaA, arenaB;
+    using Alloc = myArenaAllocator<int>;
+    myVector<int, Alloc> a{Alloc(arenaA)};
+    myVector<int, Alloc> b{Alloc(arenaB)};
+    for (int i = 0; i < 100; ++i) a.push_back(i);
+    EXPECT_TRUE(arenaA.bytes_used() >= 100 * sizeof(int));
+    EXPECT_EQ(arenaB.bytes_used(), 0);
+
+    // propagate_on_container_copy_assignment：b 改用 arenaA
+    b = a;
+    EXPECT_TRUE(b.get_allocator() == a.get_allocator());
+    EXPECT_EQ(b[99], 99);
+
+    // propagate_on_container_swap
+    myVector<int, Alloc> c{Alloc(arenaB)};
+    c.push_back(7);
+    c.swap(a);
+    EXPECT_EQ(c.get_allocator().arena, &arenaA);
+    EXPECT_EQ(a.get_allocator().arena, &arenaB);
+    EXPECT_EQ(a[0], 7);
+    EXPECT_EQ(c.size(), 100);
+}
+
+TEST(MyAllocatorTest, PoolDoesNotPropagate) {
+    myPool poolA, poolB;
+    using Alloc = myPoolAllocator<std::string>;
+    myVector<std::string, Alloc> a{Alloc(poolA)};
+    myVector<std::string, Alloc> b{Alloc(poolB)};
+    for (int i = 0; i < 10; ++i) a.push_back(std::to_string(i));
+
+    // 不同内存池之间移动赋值：不能接管指针，逐元素移动到 b 自己的池中
+    const std::string* before = &a[0];
+    b = std::move(a);
+    EXPECT_EQ(b.get_allocator().pool, &poolB);
+    EXPECT_TRUE(&b[0] != before);
+    EXPECT_EQ(b.size(), 10);
+    EXPECT_EQ(b[9], "9");
+    EXPECT_TRUE(a.empty());
+
+    // 同一内存池之间移动赋值：直接接管指针
+    myVector<std::string, Alloc> c{Alloc(poolB)};
+    const std::string* data = &b[0];
+    c = std::move(b);
+    EXPECT_TRUE(&c[0] == data);
+
+    // 释放后的同等级内存会被复用
+    myPoolAllocator<long> longs(poolA);
+    long* p = longs.allocate(4);
+    longs.deallocate(p, 4);
+    long* q = longs.allocate(3); // 24B 与 32B 同属 32B 等级
+    EXPECT_TRUE(p == q);
+    longs.deallocate(q, 3);
+}
+
+struct alignas(16) PoolAligned16 {
+    double v[2];
+};
+
+TEST(MyAllocatorTest, PoolRespectsAlignment) {
+    // 8B 等级的格子把 chunk 游标推到 8 字节边界，随后的 16B 对齐类型仍须对齐
+    myPool pool;
+    myPoolAllocator<char> bytes(pool);
+    myPoolAllocator<PoolAligned16> aligned(pool);
+    bool ok = true;
+    for (int i = 0; i < 1000; ++i) {
+        char* c = bytes.allocate(1 + i % 8);
+        PoolAligned16* a = aligned.allocate(1 + i % 3);
+        ok = ok && reinterpret_cast<uintptr_t>(a) % alignof(PoolAligned16) == 0;
+        (void)c;
+    }
+    EXPECT_TRUE(ok);
+
+    myVector<PoolAligned16, myPoolAllocator<PoolAligned16>> v{aligned};
+    for (int i = 0; i < 100; ++i) v.push_back(PoolAligned16{{double(i), 0}});
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&v[0]) % 16, 0u);
+    EXPECT_EQ(v[99].v[0], 99.0);
+}
+
+TEST(MyAllocatorTest, HugePageAlignment) {
+    using Alloc = myHugePageAllocator<int>;
+    myVector<int, Alloc> v;
+    v.resize(1 << 20); // 4MB
+    v[(1 << 20) - 1] = 42;
+    EXPECT_EQ(v[(1 << 20) - 1], 42);
+#if defined(__linux__)
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.begin()) % Alloc::huge_page_size, 0);
+#endif
+    myVector<int, Alloc> small;
+    small.push_back(1); // 小块仍走 operator new
+    EXPECT_EQ(small[0], 1);
+}
+
+TEST(MyAllocatorTest, AllocatorBenchmark) {
+    // 1. TLB 敏感：大数组随机读取（每次访问几乎必然落在不同的 4KB 页）
+    const size_t N = size_t(1) << 24; // 64MB of int
+    const size_t probes = 4000000;
+    auto gather = [&](auto& v) {
+        v.resize(N);
+        for (size_t i = 0; i < N; ++i) v[i] = static_cast<int>(i);
+        uint64_t x = 88172645463325252ULL, sum = 0;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < probes; ++i) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17; // xorshift
+            sum += v[x & (N - 1)];
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        return std::make_pair(std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count(), sum);
+    };
+    myVector<int> normal;
+    myVector<int, myHugePageAllocator<int>> huge;
+    auto rn = gather(normal);
+    auto rh = gather(huge);
+    std::cout << "    [Perf] random gather 64MB: std::allocator " << rn.first
+              << "ms, huge page " << rh.first << "ms\n";
+    EXPECT_EQ(rn.second, rh.second);
+
+    // 2. 分配密集：大量短生命周期的小 vector
+    const int rounds = 200000;
+    long long sink = 0;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        myVector<int> v;
+        for (int i = 0; i < 16; ++i) v.push_back(i);
+        sink += v.size();
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    myPool pool;
+    for (int r = 0; r < rounds; ++r) {
+        myVector<int, myPoolAllocator<int>> v{myPoolAllocator<int>(pool)};
+        for (int i = 0; i < 16; ++i) v.push_back(i);
+        sink += v.size();
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    myArena arena;
+    for (int r = 0; r < rounds; ++r) {
+        myVector<int, myArenaAllocator<int>> v{myArenaAllocator<int>(arena)};
+        for (int i = 0; i < 16; ++i) v.push_back(i);
+        sink += v.size();
+        if (r % 1024 == 1023) arena.release(); // 批量释放
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+    std::cout << "    [Perf] small vector churn: std " << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+              << "ms, pool " << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count()
+              << "ms, arena " << std::chrono::duration_cast<std::chrono::milliseconds>(t3 - t2).count() << "ms\n";
+    EXPECT_EQ(sink, 3LL * rounds * 16);
+}
+
+#endif // TEST_MYALLOCATOR_HPP
@@ -0,0 +1,189 @@
+#ifndef TEST_MYBITVECTOR_HPP
+#define TEST_MYBITVECTOR_HPP
+
+#include "../test.h"
+#include "../myVector/myBitVector.h"
+#include "../myVector/myPackedVector.h"
+#include "../myVector/myVector.h"
+#include <random>
+
+using namespace TestHelpers;
+
+TEST(MyBitVectorTest, BasicAndRanges) {
+    myBitVector b;
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(b.find_first(), myBitVector::npos);
+    for (int i = 0; i < 200; ++i) b.push_back(i % 3 == 0);
+    EXPECT_EQ(b.size(), 200);
+    EXPECT_EQ(b.count(), 67);
+    EXPECT_TRUE(b[0] && !b[1] && b[3]);
+    EXPECT_EQ(b.find_first(), 0);
+    EXPECT_EQ(b.find_next(0), 3);
+    EXPECT_EQ(b.find_next(63), 66);
+    EXPECT_EQ(b.find_next(198), myBitVector::npos);
+
+    b[1] = true;
+    b.flip(3);
+    EXPECT_TRUE(b.test(1) && !b.test(3));
+    b.reset_all();
+    EXPECT_TRUE(b.none());
+
+    // 跨字区间：首尾字掩码 + 中间整字
+    b.set_range(5, 150);
+    EXPECT_EQ(b.count(), 145);
+    EXPECT_EQ(b.find_first(), 5);
+    EXPECT_TRUE(!b[4] && b[5] && b[149] && !b[150]);
+    b.reset_range(60, 70);
+    EXPECT_EQ(b.count(), 135);
+    EXPECT_EQ(b.find_next(59), 70);
+    b.set_range(10, 10);                    // 空区间
+    EXPECT_EQ(b.count(), 135);
+
+    bool thrown = false;
+    try {
+        b.set_range(0, 201);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+
+    // 截断后尾部位清零，再扩展时不会 "复活"
+    b.resize(100);
+    EXPECT_EQ(b.count(), 85);
+    b.resize(200);
+    EXPECT_EQ(b.count(), 85);
+    b.resize(250, true);
+    EXPECT_EQ(b.count(), 135);
+    b.flip_all();
+    EXPECT_EQ(b.count(), 115);
+    while (b.size() > 64) b.pop_back();
+    EXPECT_EQ(b.word_size(), 1);
+}
+
+TEST(MyBitVectorTest, BitwiseOps) {
+    myBitVector a(130), b(130);
+    for (size_t i = 0; i < 130; i += 2) a.set(i);
+    for (size_t i = 0; i < 130; i += 3) b.set(i);
+    EXPECT_EQ((a & b).count(), 22);          // 6 的倍数
+    EXPECT_EQ((a | b).count(), 65 + 44 - 22);
+    EXPECT_EQ((a ^ b).count(), 65 + 44 - 44);
+    myBitVector c = a;
+    c ^= a;
+    EXPECT_TRUE(c.none());
+    EXPECT_TRUE(a == a);
+    EXPECT_TRUE(a != b);
+
+    bool thrown = false;
+    try {
+        myBitVector d(10);
+        d &= a;
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+}
+
+TEST(MyPackedVectorTest, GetSetUnpack) {
+    myPackedVector<10> p;
+    for (uint32_t i = 0; i < 1000; ++i) p.push_back(i);
+    EXPECT_EQ(p.size(), 1000);
+    EXPECT_EQ(p[6], 6);                      // 第一个跨字元素
+    EXPECT_EQ(p.back(), 999);
+    p[6] = 1023;
+    EXPECT_EQ(p.get(5), 5);
+    EXPECT_EQ(p.get(6), 1023);
+    EXPECT_EQ(p.get(7), 7);
+
+    bool thrown = false;
+    try {
+        p.push_back(1024);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+    EXPECT_EQ(p.size(), 1000);
+
+    uint32_t buf[300];
+    EXPECT_EQ(p.unpack(3, 300, buf), 300);
+    bool same = true;
+    for (size_t i = 0; i < 300; ++i) same = same && buf[i] == p.get(3 + i);
+    EXPECT_TRUE(same);
+    EXPECT_EQ(p.unpack(990, 300, buf), 10);
+    EXPECT_EQ(buf[9], 999);
+
+    p.resize(7);
+    p.resize(20);
+    EXPECT_EQ(p[6], 1023);
+    EXPECT_EQ(p[7], 0);                      // 截断位已清零
+    p.pop_back();
+    EXPECT_EQ(p.size(), 19);
+
+    // 各种位宽：与 myVector 参照结果逐一比对
+    auto roundTrip = [](auto packed, uint64_t limit) {
+        std::mt19937_64 rng(42);
+        myVector<uint64_t> ref;
+        for (int i = 0; i < 777; ++i) {
+            uint64_t v = rng() & limit;
+            ref.push_back(v);
+            packed.push_back(static_cast<typename decltype(packed)::value_type>(v));
+        }
+        typename decltype(packed)::value_type out[777];
+        packed.unpack(0, 777, out);
+        for (size_t i = 0; i < ref.size(); ++i) {
+            if (packed[i] != ref[i] || out[i] != ref[i]) return false;
+        }
+        return true;
+    };
+    EXPECT_TRUE(roundTrip(myPackedVector<1>(), 1));
+    EXPECT_TRUE(roundTrip(myPackedVector<7>(), 127));
+    EXPECT_TRUE(roundTrip(myPackedVector<32>(), 0xFFFFFFFFull));
+    EXPECT_TRUE(roundTrip(myPackedVector<33>(), (1ull << 33) - 1));
+    EXPECT_TRUE(roundTrip(myPackedVector<64>(), ~0ull));
+}
+
+TEST(MyBitVectorTest, PerformanceMemoryAndScan) {
+    const size_t N = 10000000;
+    std::mt19937 rng(7);
+    myVector<bool> bytes;
+    myBitVector bits;
+    myVector<int> ids;
+    myPackedVector<10> packed;
+    bytes.reserve(N);
+    bits.reserve(N);
+    ids.reserve(N);
+    packed.reserve(N);
+    for (size_t i = 0; i < N; ++i) {
+        uint32_t r = rng();
+        bytes.push_back(r & 1);
+        bits.push_back(r & 1);
+        ids.push_back(static_cast<int>(r >> 22));
+        packed.push_back(r >> 22);
+    }
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    size_t byteCount = 0;
+    for (size_t i = 0; i < bytes.size(); ++i) byteCount += bytes[i];
+    auto t1 = std::chrono::high_resolution_clock::now();
+    size_t bitCount = bits.count();
+    auto t2 = std::chrono::high_resolution_clock::now();
+    long idSum = 0;
+    for (size_t i = 0; i < ids.size(); ++i) idSum += ids[i];
+    auto t3 = std::chrono::high_resolution_clock::now();
+    long packedSum = 0;
+    uint32_t buf[1024];
+    for (size_t i = 0; i < packed.size(); i += 1024) {
+        size_t n = packed.unpack(i, 1024, buf);
+        for (size_t k = 0; k < n; ++k) packedSum += buf[k];
+    }
+    auto t4 = std::chrono::high_resolution_clock::now();
+
+    auto us = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count(); };
+    std::cout << "    [Perf] flags x" << N << ": myVector<bool> " << bytes.capacity() / 1024 << "KB / "
+              << us(t0, t1) << "us, myBitVector " << bits.memory_bytes() / 1024 << "KB / " << us(t1, t2) << "us\n";
+    std::cout << "    [Perf] 10-bit ids x" << N << ": myVector<int> " << ids.capacity() * sizeof(int) / 1024 << "KB / "
+              << us(t2, t3) << "us, myPackedVector<10> " << packed.memory_bytes() / 1024 << "KB / " << us(t3, t4) << "us\n";
+    EXPECT_EQ(byteCount, bitCount);
+    EXPECT_EQ(idSum, packedSum);
+}
+
+#endif // TEST_MYBITVECTOR_HPP
@@ -0,0 +1,127 @@
+#ifndef TEST_MYCOMPRESSEDINTVECTOR_HPP
+#define TEST_MYCOMPRESSEDINTVECTOR_HPP
+
+#include "../test.h"
+#include "../myVector/myCompressedIntVector.h"
+#include "../myVector/myVector.h"
+#include "../myVector/intVector/intVector.h"
+#include <algorithm>
+#include <random>
+
+using namespace TestHelpers;
+
+TEST(MyCompressedIntVectorTest, RoundTripAndAccess) {
+    std::mt19937 rng(3);
+    myVector<uint32_t> ids;
+    uint32_t cur = 1000;
+    for (int i = 0; i < 1000; ++i) {
+        cur += rng() % 50;                       // 有序、差值小（含重复值）
+        ids.push_back(cur);
+    }
+    myCompressedIntVector c(ids);
+    EXPECT_EQ(c.size(), 1000);
+    EXPECT_EQ(c.block_count(), 8);               // 7 个满块 + 尾块
+
+    bool same = true;
+    for (size_t i = 0; i < ids.size(); ++i) same = same && c[i] == ids[i];
+    myVector<uint32_t> all;
+    all.resize(c.size());
+    c.decode(all.begin());
+    same = same && std::equal(all.begin(), all.end(), ids.begin());
+    EXPECT_TRUE(same);
+
+    // lower_bound 与 std::lower_bound 一致：块首、块内、尾块、越界
+    bool found = true;
+    const uint32_t probes[] = { 0, 1000, ids[0], ids[127], ids[128], ids[500] + 1, ids[999], ids[999] + 1 };
+    for (uint32_t v : probes) {
+        size_t expect = std::lower_bound(ids.begin(), ids.end(), v) - ids.begin();
+        found = found && c.lower_bound(v) == expect;
+    }
+    for (int k = 0; k < 2000; ++k) {
+        uint32_t v = 1000 + rng() % 26000;
+        size_t expect = std::lower_bound(ids.begin(), ids.end(), v) - ids.begin();
+        found = found && c.lower_bound(v) == expect;
+    }
+    EXPECT_TRUE(found);
+    EXPECT_TRUE(c.contains(ids[333]));
+    EXPECT_FALSE(c.contains(ids[999] + 1));
+
+    bool thrown = false;
+    try {
+        c.at(1000);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+}
+
+TEST(MyCompressedIntVectorTest, WidthsAndSources) {
+    // 各种差值位宽，包括全相等 (0 bit) 与 32 bit、以及非有序序列（回绕差值）
+    std::mt19937 rng(9);
+    bool ok = true;
+    const uint32_t spans[] = { 0, 1, 2, 255, 65536, 0xFFFFFFFFu };
+    for (uint32_t span : spans) {
+        myVector<uint32_t> src;
+        for (int i = 0; i < 300; ++i) src.push_back(span == 0 ? 7u : static_cast<uint32_t>(rng()) % span);
+        myCompressedIntVector c(src);
+        uint32_t block[myCompressedIntVector::block_size];
+        for (size_t b = 0; b < c.block_count(); ++b) {
+            size_t n = c.decode_block(b, block);
+            for (size_t i = 0; i < n; ++i) ok = ok && block[i] == src[b * 128 + i];
+        }
+    }
+    EXPECT_TRUE(ok);
+
+    intVector iv;
+    for (int i = -100; i < 200; ++i) iv.push_back(i * 3);
+    myCompressedIntVector fromInt(iv);
+    EXPECT_EQ(fromInt.size(), 300);
+    EXPECT_EQ(static_cast<int>(fromInt[0]), -300);
+    EXPECT_EQ(static_cast<int>(fromInt[299]), 597);
+
+    // 流式追加
+    myCompressedIntVector stream;
+    for (uint32_t i = 0; i < 1000; ++i) stream.push_back(i * 2);
+    EXPECT_EQ(stream[999], 1998);
+    EXPECT_EQ(stream.lower_bound(1001), 501);
+    stream.clear();
+    EXPECT_TRUE(stream.empty());
+}
+
+TEST(MyCompressedIntVectorTest, PerformanceMemoryAndDecode) {
+    const size_t N = 10000000;
+    std::mt19937 rng(17);
+    myVector<uint32_t> ids;
+    ids.reserve(N);
+    uint32_t cur = 0;
+    for (size_t i = 0; i < N; ++i) {
+        cur += 1 + rng() % 16;
+        ids.push_back(cur);
+    }
+    auto t0 = std::chrono::high_resolution_clock::now();
+    myCompressedIntVector c(ids);
+    auto t1 = std::chrono::high_resolution_clock::now();
+
+    uint64_t plainSum = 0, packedSum = 0;
+    for (size_t i = 0; i < N; ++i) plainSum += ids[i];
+    auto t2 = std::chrono::high_resolution_clock::now();
+    uint32_t block[myCompressedIntVector::block_size];
+    for (size_t b = 0; b < c.block_count(); ++b) {
+        size_t n = c.decode_block(b, block);
+        for (size_t i = 0; i < n; ++i) packedSum += block[i];
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+    size_t hits = 0;
+    for (int k = 0; k < 100000; ++k) hits += c.contains(static_cast<uint32_t>(rng()) % cur);
+    auto t4 = std::chrono::high_resolution_clock::now();
+
+    auto us = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count(); };
+    std::cout << "    [Perf] sorted ids x" << N << ": myVector<uint32_t> " << ids.capacity() * 4 / 1024
+              << "KB, compressed " << c.memory_bytes() / 1024 << "KB (encode " << us(t0, t1) / 1000 << "ms)\n";
+    std::cout << "    [Perf] full scan: plain " << us(t1, t2) << "us, block decode " << us(t2, t3)
+              << "us; 100000 lookups " << us(t3, t4) << "us\n";
+    EXPECT_EQ(plainSum, packedSum);
+    EXPECT_TRUE(hits > 0);
+}
+
+#endif // TEST_MYCOMPRESSEDINTVECTOR_HPP
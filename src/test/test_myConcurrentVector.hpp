@@ -0,0 +1,143 @@
+#ifndef TEST_MYCONCURRENTVECTOR_HPP
+#define TEST_MYCONCURRENTVECTOR_HPP
+
+#include "../test.h"
+#include "../myVector/myConcurrentVector.h"
+#include "../myVector/myVector.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace TestHelpers;
+
+// 事件记录：check 由其余字段算出，读者据此判断是否读到了 "写了一半" 的元素
+struct ConcurrentEvent {
+    uint32_t producer;
+    uint32_t seq;
+    uint64_t check;
+    ConcurrentEvent(uint32_t p, uint32_t s) : producer(p), seq(s), check((uint64_t(p) << 32 | s) * 0x9E3779B97F4A7C15ull) {}
+    bool valid() const { return check == (uint64_t(producer) << 32 | seq) * 0x9E3779B97F4A7C15ull; }
+};
+
+TEST(MyConcurrentVectorTest, SingleThreadBasics) {
+    myConcurrentVector<int> v;
+    EXPECT_TRUE(v.empty());
+    int* first = nullptr;
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(v.push_back(i), static_cast<size_t>(i));
+        if (i == 0) first = &v[0];
+    }
+    EXPECT_EQ(v.size(), 1000u);
+    EXPECT_TRUE(first == &v[0]);            // 元素从不移动
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+    EXPECT_EQ(v.end() - v.begin(), 1000);
+    EXPECT_TRUE(v.capacity() >= 1000u);
+
+    bool thrown = false;
+    try {
+        v.at(1000);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+
+    // 非平凡类型：构造 / 析构配对
+    Obj::resetStats();
+    {
+        myConcurrentVector<Obj> objs;
+        objs.reserve(100);
+        for (int i = 0; i < 100; ++i) objs.emplace_back("e", i);
+        EXPECT_EQ(objs[99].id, 99);
+        EXPECT_EQ(Obj::copy_count, 0);
+        objs.clear();
+        EXPECT_EQ(objs.size(), 0u);
+        EXPECT_EQ(Obj::construct_count + Obj::move_count, Obj::destruct_count);   // 构造可能抛异常：先建临时对象再移动进槽位
+        objs.push_back(Obj("again", 7));
+        EXPECT_EQ(objs.at(0).id, 7);
+    }
+    EXPECT_EQ(Obj::construct_count + Obj::copy_count + Obj::move_count, Obj::destruct_count);
+}
+
+TEST(MyConcurrentVectorTest, ConcurrentProducersAndReaders) {
+    const uint32_t producers = 4, perProducer = 50000;
+    myConcurrentVector<ConcurrentEvent> v;
+    std::atomic<bool> done(false);
+    std::atomic<bool> torn(false);
+
+    // 读者在写入期间反复遍历已发布部分：不加锁，且不应看到未构造完的元素
+    std::thread reader([&]() {
+        while (!done.load(std::memory_order_acquire)) {
+            size_t n = v.size();
+            for (size_t i = 0; i < n; ++i) {
+                if (!v[i].valid()) torn.store(true);
+            }
+        }
+    });
+    std::vector<std::thread> workers;
+    for (uint32_t p = 0; p < producers; ++p) {
+        workers.emplace_back([&v, p, perProducer]() {
+            for (uint32_t s = 0; s < perProducer; ++s) v.emplace_back(p, s);
+        });
+    }
+    for (std::thread& t : workers) t.join();
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_FALSE(torn.load());
+    EXPECT_EQ(v.size(), size_t(producers) * perProducer);
+    // 每个生产者的事件都在，且按该生产者的写入顺序排列
+    std::vector<uint32_t> next(producers, 0);
+    bool ordered = true;
+    for (const ConcurrentEvent& e : v) {
+        ordered = ordered && e.valid() && e.seq == next[e.producer];
+        next[e.producer] ++;
+    }
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(std::all_of(next.begin(), next.end(), [&](uint32_t n) { return n == perProducer; }));
+}
+
+TEST(MyConcurrentVectorTest, PerformanceThroughput) {
+    const size_t total = 4000000;
+    auto ms = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count(); };
+    size_t maxThreads = std::max<size_t>(std::thread::hardware_concurrency(), 4);
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        size_t perThread = total / threads;
+
+        myVector<ConcurrentEvent> locked;
+        std::mutex mutex;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        {
+            std::vector<std::thread> workers;
+            for (size_t p = 0; p < threads; ++p) {
+                workers.emplace_back([&, p]() {
+                    for (size_t s = 0; s < perThread; ++s) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        locked.push_back(ConcurrentEvent(uint32_t(p), uint32_t(s)));
+                    }
+                });
+            }
+            for (std::thread& t : workers) t.join();
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        myConcurrentVector<ConcurrentEvent> concurrent;
+        {
+            std::vector<std::thread> workers;
+            for (size_t p = 0; p < threads; ++p) {
+                workers.emplace_back([&, p]() {
+                    for (size_t s = 0; s < perThread; ++s) concurrent.emplace_back(uint32_t(p), uint32_t(s));
+                });
+            }
+            for (std::thread& t : workers) t.join();
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        std::cout << "    [Perf] " << threads << " producer(s), " << perThread * threads << " events: mutex + myVector "
+                  << ms(t0, t1) << "ms, myConcurrentVector " << ms(t1, t2) << "ms\n";
+        EXPECT_EQ(locked.size(), concurrent.size());
+    }
+}
+
+#endif // TEST_MYCONCURRENTVECTOR_HPP
@@ -0,0 +1,147 @@
+#ifndef TEST_MYFLATMAP_HPP
+#define TEST_MYFLATMAP_HPP
+
+#include "../test.h"
+#include "../myFlatMap/myFlatSet.h"
+#include "../myFlatMap/myFlatMap.h"
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+
+using namespace TestHelpers;
+
+TEST(MyFlatSetTest, BuildLookupAndMerge) {
+    myFlatSet<int> s = { 5, 3, 9, 3, 1, 5, 7 };
+    EXPECT_EQ(s.size(), 5);
+    EXPECT_TRUE(std::is_sorted(s.begin(), s.end()));
+    EXPECT_TRUE(s.contains(7));
+    EXPECT_FALSE(s.contains(4));
+    EXPECT_EQ(*s.lower_bound(4), 5);
+    EXPECT_EQ(*s.upper_bound(5), 7);
+    EXPECT_TRUE(s.lower_bound(10) == s.end());
+
+    EXPECT_TRUE(s.insert(4).second);
+    EXPECT_FALSE(s.insert(4).second);
+    EXPECT_EQ(s.erase(9), 1);
+    EXPECT_EQ(s.erase(9), 0);
+
+    // 归并式批量插入：与已有元素、以及新元素之间的重复都只保留一个
+    s.insert_range({ 10, 2, 2, 3, 8, 0 });
+    myFlatSet<int> expect = { 0, 1, 2, 3, 4, 5, 7, 8, 10 };
+    EXPECT_TRUE(s == expect);
+
+    // 自定义比较器：降序
+    myFlatSet<std::string, std::greater<std::string>> names = { "b", "a", "c", "a" };
+    EXPECT_EQ(names.size(), 3);
+    EXPECT_EQ(names[0], std::string("c"));
+    EXPECT_TRUE(names.find("a") != names.end());
+
+    // 随机比对
+    std::mt19937 rng(1);
+    myFlatSet<int> fs;
+    std::set<int> ref;
+    bool same = true;
+    for (int round = 0; round < 20; ++round) {
+        myVector<int> batch;
+        for (int i = 0; i < 100; ++i) batch.push_back(static_cast<int>(rng() % 1000));
+        fs.insert_range(batch.begin(), batch.end());
+        ref.insert(batch.begin(), batch.end());
+        int single = static_cast<int>(rng() % 1000);
+        fs.insert(single);
+        ref.insert(single);
+    }
+    same = fs.size() == ref.size() && std::equal(fs.begin(), fs.end(), ref.begin());
+    EXPECT_TRUE(same);
+
+    // 等价但可区分的键：每组保留输入中第一次出现的那个（小写在前）
+    auto lowerLess = [](const std::string& a, const std::string& b) {
+        return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(),
+                                            [](char x, char y) { return std::tolower(x) < std::tolower(y); });
+    };
+    std::vector<int> order(300);
+    for (int i = 0; i < 300; ++i) order[i] = i;
+    std::shuffle(order.begin(), order.end(), rng);
+    myVector<std::string> words;
+    for (int i : order) words.push_back("word" + std::to_string(i));
+    for (int i : order) words.push_back("WORD" + std::to_string(i));
+    myFlatSet<std::string, decltype(lowerLess)> folded(words.begin(), words.end(), lowerLess);
+    EXPECT_EQ(folded.size(), 300);
+    EXPECT_TRUE(std::all_of(folded.begin(), folded.end(), [](const std::string& w) { return w[0] == 'w'; }));
+}
+
+TEST(MyFlatMapTest, LayoutsBehaveTheSame) {
+    auto check = [](auto& m) {
+        bool ok = m.size() == 3 && m.at(3) == "c";                  // 重复键保留第一次出现的值
+        ok = ok && m.insert(2, std::string("y")).second == false && m[2] == "b";
+        ok = ok && m.insert_or_assign(2, std::string("z")).second == false && m[2] == "z";
+        m[0] = "zero";                                              // operator[] 插入
+        ok = ok && m.begin().key() == 0 && m.size() == 4;
+
+        myVector<std::pair<int, std::string>> batch = { {5, "e"}, {1, "dup"}, {4, "d"}, {5, "dup"} };
+        m.insert_range(batch.begin(), batch.end());
+        ok = ok && m.size() == 6 && m.at(1) == "a" && m.at(5) == "e";
+        int expectKey = 0;
+        for (auto kv : m) ok = ok && kv.first == expectKey++;
+        auto it = m.find(4);
+        ok = ok && it != m.end() && it->second == "d";
+        it->second = "four";
+        ok = ok && m.at(4) == "four";
+        ok = ok && m.erase(4) == 1 && !m.contains(4) && m.erase(4) == 0;
+        ok = ok && m.lower_bound(4).key() == 5;
+        const auto& cm = m;
+        ok = ok && cm.find(100) == cm.end();
+        bool thrown = false;
+        try {
+            cm.at(100);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        return ok && thrown;
+    };
+    myFlatMap<int, std::string> interleaved = { {3, "c"}, {1, "a"}, {3, "x"}, {2, "b"} };
+    myFlatMap<int, std::string, std::less<int>, myFlatSplit> split = { {3, "c"}, {1, "a"}, {3, "x"}, {2, "b"} };
+    EXPECT_TRUE(check(interleaved));
+    EXPECT_TRUE(check(split));
+    EXPECT_EQ(split.key_data()[0], 0);
+}
+
+TEST(MyFlatMapTest, PerformanceLookup) {
+    const int N = 1000000;
+    const int Q = 2000000;
+    std::mt19937 rng(123);
+    myVector<std::pair<int, HeavyPOD>> items;
+    items.reserve(N);
+    for (int i = 0; i < N; ++i) items.push_back({ static_cast<int>(rng()), HeavyPOD(i) });
+    myVector<int> queries;
+    for (int i = 0; i < Q; ++i) queries.push_back(items[rng() % N].first);
+
+    auto ms = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count(); };
+    auto t0 = std::chrono::high_resolution_clock::now();
+    std::map<int, HeavyPOD> tree(items.begin(), items.end());
+    auto t1 = std::chrono::high_resolution_clock::now();
+    myFlatMap<int, HeavyPOD> flat(items.begin(), items.end());
+    auto t2 = std::chrono::high_resolution_clock::now();
+    myFlatMap<int, HeavyPOD, std::less<int>, myFlatSplit> split(items.begin(), items.end());
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    long treeSum = 0, flatSum = 0, splitSum = 0;
+    auto q0 = std::chrono::high_resolution_clock::now();
+    for (int q : queries) treeSum += tree.find(q)->second.data[0];
+    auto q1 = std::chrono::high_resolution_clock::now();
+    for (int q : queries) flatSum += flat.find(q).value().data[0];
+    auto q2 = std::chrono::high_resolution_clock::now();
+    for (int q : queries) splitSum += split.find(q).value().data[0];
+    auto q3 = std::chrono::high_resolution_clock::now();
+
+    std::cout << "    [Perf] build " << N << ": std::map " << ms(t0, t1) << "ms, myFlatMap " << ms(t1, t2)
+              << "ms, split " << ms(t2, t3) << "ms\n";
+    std::cout << "    [Perf] " << Q << " lookups: std::map " << ms(q0, q1) << "ms, myFlatMap " << ms(q1, q2)
+              << "ms, split " << ms(q2, q3) << "ms\n";
+    EXPECT_EQ(treeSum, flatSum);
+    EXPECT_EQ(treeSum, splitSum);
+}
+
+#endif // TEST_MYFLATMAP_HPP
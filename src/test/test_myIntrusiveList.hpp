@@ -0,0 +1,182 @@
+#ifndef TEST_MYINTRUSIVELIST_HPP
+#define TEST_MYINTRUSIVELIST_HPP
+
+#include "../test.h"
+#include "../myList/myIntrusiveList.h"
+#include "../myList/myList.h"
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace TestHelpers;
+
+// 一个任务同时挂在就绪队列与全部任务表上
+struct IntrusiveTask {
+    int id;
+    myListHook<> runHook;
+    myListHook<myLinkMode::auto_unlink> allHook;
+    explicit IntrusiveTask(int i = 0) : id(i) {}
+};
+
+using RunQueue = myIntrusiveList<IntrusiveTask, &IntrusiveTask::runHook>;
+using AllTasks = myIntrusiveList<IntrusiveTask, &IntrusiveTask::allHook>;
+
+template <typename L>
+static std::vector<int> intrusiveIds(const L& list) {
+    std::vector<int> ids;
+    for (const IntrusiveTask& t : list) ids.push_back(t.id);
+    return ids;
+}
+
+TEST(MyIntrusiveListTest, LinkUnlinkWithoutCopies) {
+    std::vector<IntrusiveTask> tasks;
+    for (int i = 0; i < 6; ++i) tasks.emplace_back(i);
+    {
+        RunQueue queue;
+        AllTasks all;
+        for (IntrusiveTask& t : tasks) {
+            queue.push_back(t);
+            all.push_front(t);
+        }
+        EXPECT_EQ(queue.size(), 6);
+        EXPECT_TRUE(intrusiveIds(queue) == std::vector<int>({0, 1, 2, 3, 4, 5}));
+        EXPECT_TRUE(intrusiveIds(all) == std::vector<int>({5, 4, 3, 2, 1, 0}));
+        EXPECT_TRUE(&queue.front() == &tasks[0]);      // 链表里就是对象本身
+        EXPECT_TRUE(tasks[3].runHook.is_linked());
+
+        // 给定对象 O(1) 摘下 / 定位
+        queue.remove(tasks[3]);
+        EXPECT_FALSE(tasks[3].runHook.is_linked());
+        auto it = queue.iterator_to(tasks[4]);
+        --it;
+        EXPECT_EQ(it->id, 2);
+        queue.insert(queue.iterator_to(tasks[1]), tasks[3]);
+        EXPECT_TRUE(intrusiveIds(queue) == std::vector<int>({0, 3, 1, 2, 4, 5}));
+        EXPECT_EQ(queue.erase(queue.begin())->id, 3);
+        queue.pop_back();
+        EXPECT_EQ(queue.back().id, 4);
+
+        // safe 钩子：重复插入会被拒绝
+        bool thrown = false;
+        try {
+            queue.push_back(tasks[1]);
+        } catch (const std::logic_error&) {
+            thrown = true;
+        }
+        EXPECT_TRUE(thrown);
+        EXPECT_EQ(queue.size(), 4);
+
+        // safe 钩子：摘下未链接的对象同样被拒绝，计数不变
+        IntrusiveTask loose(99);
+        thrown = false;
+        try {
+            queue.remove(loose);
+        } catch (const std::logic_error&) {
+            thrown = true;
+        }
+        EXPECT_TRUE(thrown);
+        thrown = false;
+        try {
+            queue.erase(queue.iterator_to(tasks[3]));
+            queue.erase(queue.iterator_to(tasks[3]));
+        } catch (const std::logic_error&) {
+            thrown = true;
+        }
+        EXPECT_TRUE(thrown);
+        EXPECT_EQ(queue.size(), 3);
+        queue.push_front(tasks[3]);
+        EXPECT_EQ(queue.size(), 4);
+
+        // auto_unlink 钩子：不经过链表直接摘下
+        tasks[2].allHook.unlink();
+        EXPECT_FALSE(tasks[2].allHook.is_linked());
+        EXPECT_TRUE(intrusiveIds(all) == std::vector<int>({5, 4, 3, 1, 0}));
+        EXPECT_EQ(all.size(), 5);
+
+        // 移动 / 交换 / 拼接：哨兵内嵌在对象中，首尾元素要改指向新的哨兵
+        RunQueue other(std::move(queue));
+        EXPECT_TRUE(queue.empty());
+        EXPECT_TRUE(intrusiveIds(other) == std::vector<int>({3, 1, 2, 4}));
+        queue.push_back(tasks[0]);
+        queue.swap(other);
+        EXPECT_TRUE(intrusiveIds(other) == std::vector<int>({0}));
+        queue.splice(queue.begin(), other);
+        EXPECT_TRUE(other.empty());
+        EXPECT_TRUE(intrusiveIds(queue) == std::vector<int>({0, 3, 1, 2, 4}));
+        EXPECT_EQ(queue.size(), 5);
+        queue.clear();
+        EXPECT_FALSE(tasks[0].runHook.is_linked());
+    }
+    // 链表析构后对象仍然有效且均已摘下
+    for (IntrusiveTask& t : tasks) {
+        EXPECT_FALSE(t.runHook.is_linked());
+        EXPECT_FALSE(t.allHook.is_linked());
+    }
+
+    // auto_unlink：对象先于链表析构时自动摘下
+    AllTasks all;
+    IntrusiveTask keep(1);
+    all.push_back(keep);
+    {
+        IntrusiveTask temporary(2);
+        all.push_back(temporary);
+        EXPECT_EQ(all.size(), 2);
+    }
+    EXPECT_EQ(all.size(), 1);
+    EXPECT_EQ(all.front().id, 1);
+    // 拷贝对象不拷贝链表成员关系
+    IntrusiveTask copy(keep);
+    EXPECT_FALSE(copy.allHook.is_linked());
+
+    // normal 钩子：无检查，行为同上
+    struct Plain {
+        myListHook<myLinkMode::normal> hook;
+        int v;
+    };
+    Plain a{{}, 1}, b{{}, 2};
+    myIntrusiveList<Plain, &Plain::hook> plain;
+    plain.push_back(a);
+    plain.push_front(b);
+    EXPECT_EQ(plain.front().v, 2);
+    plain.remove(b);
+    EXPECT_EQ(plain.size(), 1);
+    EXPECT_EQ(plain.back().v, 1);
+}
+
+TEST(MyIntrusiveListTest, PerformanceSchedulingQueue) {
+    // 调度队列：任务反复出队、入队。myList<Task*> 每次入队都要分配一个节点
+    const int tasksCount = 1000, rounds = 2000;
+    std::vector<std::unique_ptr<IntrusiveTask>> tasks;
+    for (int i = 0; i < tasksCount; ++i) tasks.push_back(std::make_unique<IntrusiveTask>(i));
+
+    myList<IntrusiveTask*> heapQueue;
+    RunQueue intrusiveQueue;
+    for (auto& t : tasks) {
+        heapQueue.push_back(t.get());
+        intrusiveQueue.push_back(*t);
+    }
+    long long s1 = 0, s2 = 0;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds * tasksCount; ++r) {
+        IntrusiveTask* t = *heapQueue.begin();
+        heapQueue.pop_front();
+        s1 += t->id;
+        heapQueue.push_back(t);
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds * tasksCount; ++r) {
+        IntrusiveTask& t = intrusiveQueue.front();
+        intrusiveQueue.pop_front();
+        s2 += t.id;
+        intrusiveQueue.push_back(t);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    auto ms = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count(); };
+    std::cout << "    [Perf] scheduling queue " << rounds * tasksCount << " pop/push: myList<Task*> " << ms(t0, t1)
+              << "ms, myIntrusiveList " << ms(t1, t2) << "ms\n";
+    EXPECT_EQ(s1, s2);
+    intrusiveQueue.clear();
+}
+
+#endif // TEST_MYINTRUSIVELIST_HPP
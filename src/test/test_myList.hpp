@@ -2,11 +2,20 @@
 #define TEST_MYLIST_HPP
 #include "../test.h"
 #include "../myList/myList.h"
+#include "../myAllocator/myNodePoolAllocator.h"
+#include "../myAllocator/myPoolAllocator.h"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 class ListTester {
 public:
     static void verify(const myList<int>& list) {
-        auto* head = list.head; // Should be accessible if friend
+        auto* head = &list.head; // Should be accessible if friend
         auto* current = head->next;
         size_t count = 0;
         
@@ -159,4 +168,335 @@ TEST(MyListTest, MoveConstructorAndAssignment) {
     EXPECT_EQ(*(++ ++ ++ ++ list3.begin()), 4);
 }
 
+TEST(MyListTest, CustomAllocator) {
+    // 分配器被 rebind 为 ListNode<T> 的分配器：每个元素一次分配（哨兵内嵌，不分配），计数记在节点分配器上
+    using Alloc = DebugAllocator<std::string>;
+    using NodeAlloc = DebugAllocator<ListNode<std::string>>;
+    int allocs = NodeAlloc::alloc_count, deallocs = NodeAlloc::dealloc_count;
+    {
+        myList<std::string, Alloc> list;
+        for (int i = 0; i < 10; ++i) list.push_back(std::to_string(i));
+        EXPECT_EQ(NodeAlloc::alloc_count - allocs, 10);
+        list.pop_front();
+        list.erase(list.begin());
+        EXPECT_EQ(NodeAlloc::dealloc_count - deallocs, 2);
+        myList<std::string, Alloc> copy(list);
+        EXPECT_EQ(copy.size(), 8);
+        EXPECT_EQ(*copy.begin(), "2");
+    }
+    EXPECT_EQ(NodeAlloc::alloc_count - allocs, NodeAlloc::dealloc_count - deallocs);
+}
+
+TEST(MyListTest, NodePoolRecyclesNodes) {
+    using Alloc = myNodePoolAllocator<int>;
+    myList<int, Alloc> list;
+    myNodePool& pool = *list.get_allocator().pool;
+    for (int i = 0; i < 1000; ++i) list.push_back(i);
+    size_t blocks = pool.block_count();
+    EXPECT_TRUE(blocks > 0);
+    EXPECT_EQ(pool.slot_size(), sizeof(ListNode<int>));
+
+    // 删除后再插入同样数量：全部复用空闲链表，不申请新块
+    for (int round = 0; round < 100; ++round) {
+        for (int i = 0; i < 500; ++i) list.pop_front();
+        for (int i = 0; i < 500; ++i) list.push_back(i);
+    }
+    EXPECT_EQ(pool.block_count(), blocks);
+    EXPECT_EQ(list.size(), 1000);
+
+    // 拷贝使用独立的池；移动 / 交换时池随节点一起转移
+    myList<int, Alloc> copy(list);
+    EXPECT_TRUE(copy.get_allocator() != list.get_allocator());
+    myList<int, Alloc> other;
+    other.push_back(-1);
+    Alloc listAlloc = list.get_allocator();
+    other.swap(list);
+    EXPECT_TRUE(other.get_allocator() == listAlloc);
+    EXPECT_EQ(*list.begin(), -1);
+    copy = other;
+    EXPECT_EQ(copy.size(), 1000);
+    EXPECT_TRUE(copy.get_allocator() != other.get_allocator());
+
+    // 移动构造后原链表仍持有可用的池，可以继续插入
+    myList<int, Alloc> stolen(std::move(other));
+    EXPECT_EQ(stolen.size(), 1000);
+    EXPECT_TRUE(stolen.get_allocator() == listAlloc);
+    other.push_back(1);
+    other.push_front(0);
+    EXPECT_EQ(other.size(), 2);
+    EXPECT_EQ(*other.begin(), 0);
+}
+
+TEST(MyListTest, MoveAssignmentWithUnequalAllocators) {
+    // myPoolAllocator 不随移动赋值传播：两个池不同时只能逐元素移动，节点各自回收到自己的池
+    using Alloc = myPoolAllocator<std::string>;
+    myPool poolA, poolB;
+    myList<std::string, Alloc> a{Alloc(poolA)};
+    myList<std::string, Alloc> b{Alloc(poolB)};
+    for (int i = 0; i < 100; ++i) a.push_back(std::string(32, char('a' + i % 26)));
+    b.push_back("old");
+    b = std::move(a);
+    EXPECT_TRUE(b.get_allocator() == Alloc(poolB));
+    EXPECT_EQ(b.size(), 100);
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(*b.begin(), std::string(32, 'a'));
+    // 两个链表都能继续使用各自的池
+    for (int i = 0; i < 100; ++i) {
+        a.push_back("a");
+        b.pop_front();
+        b.push_back("b");
+    }
+    EXPECT_EQ(a.size(), 100);
+    EXPECT_EQ(b.size(), 100);
+    EXPECT_EQ(*b.begin(), "b");
+
+    // 分配器相等时直接接管节点
+    myList<std::string, Alloc> c{Alloc(poolB)};
+    c = std::move(b);
+    EXPECT_EQ(c.size(), 100);
+    EXPECT_TRUE(b.empty());
+}
+
+TEST(MyListTest, PerformanceNodePoolChurn) {
+    // 队列式吞吐：尾部入队、头部出队，保持 1000 个元素在链表中
+    const int rounds = 2000, batch = 1000;
+    auto churn = [&](auto& list) {
+        for (int i = 0; i < batch; ++i) list.push_back(i);
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < rounds; ++r) {
+            for (int i = 0; i < batch; ++i) list.push_back(i);
+            for (int i = 0; i < batch; ++i) list.pop_front();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    };
+    myList<int> heap;
+    myList<int, myNodePoolAllocator<int>> pooled;
+    long long tHeap = churn(heap);
+    long long tPool = churn(pooled);
+    std::cout << "    [Perf] list churn " << rounds * batch << " push/pop: new/delete " << tHeap
+              << "ms, node pool " << tPool << "ms (" << pooled.get_allocator().pool->block_count() << " blocks)\n";
+    EXPECT_EQ(heap.size(), pooled.size());
+}
+
+// myList 的迭代器不带 iterator_traits，不能直接用来构造 std::vector
+template <typename L>
+static auto listToVector(const L& list) {
+    std::vector<std::decay_t<decltype(*list.begin())>> out;
+    for (auto it = list.begin(); it != list.end(); ++it) out.push_back(*it);
+    return out;
+}
+
+TEST(MyListTest, SpliceAndMerge) {
+    myList<int> a, b;
+    for (int i = 1; i <= 3; ++i) a.push_back(i);       // 1 2 3
+    for (int i = 7; i <= 9; ++i) b.push_back(i);       // 7 8 9
+
+    // 整体拼接
+    a.splice(++a.begin(), b);
+    EXPECT_TRUE(listToVector(a) == std::vector<int>({1, 7, 8, 9, 2, 3}));
+    EXPECT_TRUE(b.empty());
+    ListTester::verify(a);
+    ListTester::verify(b);
+
+    // 单个节点：跨链表与同链表内移动
+    b.splice(b.end(), a, a.begin());
+    a.splice(a.end(), a, a.begin());
+    EXPECT_TRUE(listToVector(a) == std::vector<int>({8, 9, 2, 3, 7}));
+    EXPECT_TRUE(listToVector(b) == std::vector<int>({1}));
+    a.splice(a.begin(), a, a.begin());                  // 原地不动
+    EXPECT_EQ(*a.begin(), 8);
+
+    // 区间：同链表内与跨链表
+    auto first = ++a.begin(), last = first;
+    ++ ++ last;                                         // [9, 2]
+    a.splice(a.end(), a, first, last);
+    EXPECT_TRUE(listToVector(a) == std::vector<int>({8, 3, 7, 9, 2}));
+    b.splice(b.begin(), a, ++a.begin(), a.end());
+    EXPECT_TRUE(listToVector(b) == std::vector<int>({3, 7, 9, 2, 1}));
+    EXPECT_EQ(a.size(), 1);
+    EXPECT_EQ(b.size(), 5);
+    ListTester::verify(a);
+    ListTester::verify(b);
+
+    // merge：稳定，相等元素中 this 的在前
+    myList<std::pair<int, int>> x, y;
+    for (int k : {1, 3, 3, 5}) x.push_back({k, 0});
+    for (int k : {0, 3, 4, 6, 7}) y.push_back({k, 1});
+    auto byKey = [](const std::pair<int, int>& l, const std::pair<int, int>& r) { return l.first < r.first; };
+    x.merge(y, byKey);
+    std::vector<std::pair<int, int>> expected = {{0, 1}, {1, 0}, {3, 0}, {3, 0}, {3, 1}, {4, 1}, {5, 0}, {6, 1}, {7, 1}};
+    EXPECT_TRUE(listToVector(x) == expected);
+    EXPECT_TRUE(y.empty());
+    EXPECT_EQ(x.size(), 9);
+}
+
+TEST(MyListTest, SortUniqueRemove) {
+    std::mt19937 rng(21);
+    for (int n : {0, 1, 2, 3, 17, 64, 1000, 4097}) {
+        myList<int> list;
+        std::vector<int> ref;
+        for (int i = 0; i < n; ++i) {
+            int v = static_cast<int>(rng() % 50);
+            list.push_back(v);
+            ref.push_back(v);
+        }
+        list.sort();
+        std::sort(ref.begin(), ref.end());
+        EXPECT_TRUE(listToVector(list) == ref);
+        ListTester::verify(list);
+
+        size_t removed = list.unique();
+        ref.erase(std::unique(ref.begin(), ref.end()), ref.end());
+        EXPECT_EQ(removed + list.size(), static_cast<size_t>(n));
+        EXPECT_TRUE(listToVector(list) == ref);
+        ListTester::verify(list);
+    }
+
+    // 稳定性：按键排序后，同键元素保持原相对顺序
+    myList<std::pair<int, int>> pairs;
+    for (int i = 0; i < 500; ++i) pairs.push_back({static_cast<int>(rng() % 10), i});
+    pairs.sort([](const std::pair<int, int>& l, const std::pair<int, int>& r) { return l.first < r.first; });
+    std::vector<std::pair<int, int>> sorted = listToVector(pairs);
+    EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+
+    // remove / remove_if；remove 的参数引用链表内的元素也安全
+    myList<int> list;
+    for (int i = 0; i < 20; ++i) list.push_back(i % 4);
+    EXPECT_EQ(list.remove(*list.begin()), 5);
+    EXPECT_EQ(list.remove_if([](int x) { return x == 3; }), 5);
+    EXPECT_TRUE(listToVector(list) == std::vector<int>({1, 2, 1, 2, 1, 2, 1, 2, 1, 2}));
+    list.sort(std::greater<>());
+    EXPECT_EQ(list.unique([](int l, int r) { return l == r; }), 8);
+    EXPECT_TRUE(listToVector(list) == std::vector<int>({2, 1}));
+    ListTester::verify(list);
+}
+
+TEST(MyListTest, RelinkOperationsDoNotCopy) {
+    myList<Obj> list, other;
+    for (int i = 0; i < 300; ++i) list.emplace_back("n", (i * 37) % 101);
+    for (int i = 0; i < 50; ++i) other.emplace_back("m", i * 2);
+    auto byId = [](const Obj& l, const Obj& r) { return l.id < r.id; };
+
+    // 排序 / 归并 / 拼接只改指针：不构造、不拷贝、不移动任何元素
+    Obj::resetStats();
+    list.sort(byId);
+    list.merge(other, byId);
+    other.splice(other.end(), list, list.begin(), ++ ++ list.begin());
+    EXPECT_EQ(Obj::construct_count + Obj::copy_count + Obj::move_count + Obj::destruct_count, 0);
+    EXPECT_EQ(list.size() + other.size(), 350);
+
+    // 比较抛异常：基本保证，所有节点仍在链表中
+    int calls = 0;
+    bool thrown = false;
+    try {
+        list.sort([&calls](const Obj& l, const Obj& r) {
+            if (++calls == 500) throw std::runtime_error("compare failed");
+            return l.id > r.id;
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+    EXPECT_EQ(list.size(), 348);
+    size_t count = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) ++ count;
+    EXPECT_EQ(count, 348);
+    EXPECT_EQ(Obj::destruct_count, 0);
+}
+
+TEST(MyListTest, EmplaceAndMoveInsertion) {
+    Obj::resetStats();
+    {
+        // 哨兵不含 T：空链表不构造任何元素，Obj 也不需要默认构造函数
+        myList<Obj> list;
+        EXPECT_EQ(Obj::construct_count, 0);
+
+        // emplace 系列直接在节点内构造：零拷贝、零移动
+        list.emplace_back("b", 2);
+        list.emplace_front("a", 1);
+        Obj& last = list.emplace_back("d", 4);
+        auto it = list.emplace(--list.end(), "c", 3);
+        EXPECT_EQ(it->id, 3);
+        EXPECT_EQ(last.id, 4);
+        EXPECT_EQ(Obj::construct_count, 4);
+        EXPECT_EQ(Obj::copy_count, 0);
+        EXPECT_EQ(Obj::move_count, 0);
+
+        // 右值版本：移动一次，不拷贝
+        Obj e("e", 5), f("f", 6), g("g", 7);
+        list.push_back(std::move(e));
+        list.push_front(std::move(f));
+        list.insert(++list.begin(), std::move(g));
+        EXPECT_EQ(Obj::move_count, 3);
+        EXPECT_EQ(Obj::copy_count, 0);
+        EXPECT_EQ(e.name, "(moved)");
+
+        // 左值仍然拷贝
+        Obj h("h", 8);
+        list.push_back(h);
+        EXPECT_EQ(Obj::copy_count, 1);
+
+        std::vector<int> ids;
+        for (auto i = list.begin(); i != list.end(); ++i) ids.push_back((*i).id);
+        EXPECT_TRUE(ids == std::vector<int>({6, 7, 1, 2, 3, 4, 5, 8}));
+
+        // 移动后原链表是合法的空链表，可以继续使用
+        myList<Obj> moved(std::move(list));
+        EXPECT_TRUE(list.empty());
+        list.emplace_back("again", 9);
+        EXPECT_EQ((*list.begin()).id, 9);
+        EXPECT_EQ(moved.size(), 8);
+        list = std::move(moved);
+        EXPECT_EQ(list.size(), 8);
+    }
+    EXPECT_EQ(Obj::construct_count + Obj::copy_count + Obj::move_count, Obj::destruct_count);
+
+    // 不可默认构造、只可移动的类型
+    myList<std::unique_ptr<int>> owners;
+    owners.push_back(std::make_unique<int>(1));
+    owners.emplace_front(new int(0));
+    EXPECT_EQ(**owners.begin(), 0);
+    EXPECT_EQ(owners.size(), 2);
+    ListTester::verify(myList<int>());
+}
+
+// 大元素：排序时移动一次要拷贝 256 字节
+struct ListSortRecord {
+    int key;
+    char payload[252];
+    ListSortRecord(int k = 0) : key(k), payload() {}
+    bool operator<(const ListSortRecord& other) const { return key < other.key; }
+    bool operator==(const ListSortRecord& other) const { return key == other.key; }
+};
+
+template <typename T>
+static void runListSortBenchmark(const char* label, int n) {
+    std::mt19937 rng(5);
+    myList<T> a, b;
+    for (int i = 0; i < n; ++i) {
+        int v = static_cast<int>(rng());
+        a.push_back(T(v));
+        b.push_back(T(v));
+    }
+    auto t0 = std::chrono::high_resolution_clock::now();
+    a.sort();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    // 旧做法：拷贝到 vector 排序后写回
+    std::vector<T> tmp = listToVector(b);
+    std::sort(tmp.begin(), tmp.end());
+    b.clear();
+    for (const T& v : tmp) b.push_back(v);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    auto ms = [](auto x, auto y) { return std::chrono::duration_cast<std::chrono::milliseconds>(y - x).count(); };
+    std::cout << "    [Perf] list sort " << n << " " << label << ": myList::sort " << ms(t0, t1)
+              << "ms, copy to vector + std::sort + rebuild " << ms(t1, t2) << "ms\n";
+    EXPECT_TRUE(listToVector(a) == tmp);
+}
+
+TEST(MyListTest, PerformanceSort) {
+    runListSortBenchmark<int>("ints", 1000000);
+    runListSortBenchmark<ListSortRecord>("256B records", 200000);
+}
+
 #endif // TEST_MYLIST_HPP
\ No newline at end of file
@@ -0,0 +1,83 @@
+#ifndef TEST_MYMAPPEDVECTOR_HPP
+#define TEST_MYMAPPEDVECTOR_HPP
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include "../test.h"
+#include "../myVector/myMappedVector.h"
+#include "../myVector/myVector.h"
+#include <cstdio>       // std::remove
+
+using namespace TestHelpers;
+
+TEST(MyMappedVectorTest, PersistAndReopen) {
+    const std::string path = "/tmp/myMappedVector_test.bin";
+    std::remove(path.c_str());
+    {
+        myMappedVector<HeavyPOD> v(path);
+        EXPECT_TRUE(v.empty());
+        for (int i = 0; i < 1000; ++i) v.push_back(HeavyPOD(i));
+        v.push_back(v[0]); // 引用映射区内元素，可能触发重新映射
+        v.flush();
+    }
+    {
+        // 重新打开：不解析任何元素，直接可用
+        myMappedVector<HeavyPOD> v(path);
+        EXPECT_EQ(v.size(), 1001);
+        EXPECT_EQ(v[999].data[7], 999);
+        EXPECT_EQ(v.back().data[0], 0);
+        v.pop_back();
+        v.resize(1500);
+        EXPECT_EQ(v[1499].data[3], 0);
+        EXPECT_EQ(v.at(1).data[0], 1);
+    }
+    {
+        // 元素类型不匹配：文件头校验失败
+        bool thrown = false;
+        try {
+            myMappedVector<int> wrong(path);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        EXPECT_TRUE(thrown);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(MyMappedVectorTest, RestartBenchmark) {
+    // 对比 "逐个写盘 + push_back 重建" 与 "映射文件重新打开"
+    const std::string path = "/tmp/myMappedVector_bench.bin";
+    const std::string dump = "/tmp/myMappedVector_bench.dump";
+    std::remove(path.c_str());
+    const int N = 500000;
+    {
+        myMappedVector<HeavyPOD> v(path);
+        v.reserve(N);
+        for (int i = 0; i < N; ++i) v.push_back(HeavyPOD(i));
+        FILE* f = std::fopen(dump.c_str(), "wb");
+        for (int i = 0; i < N; ++i) std::fwrite(&v[i], sizeof(HeavyPOD), 1, f);
+        std::fclose(f);
+    }
+    auto t0 = std::chrono::high_resolution_clock::now();
+    myVector<HeavyPOD> rebuilt;
+    {
+        FILE* f = std::fopen(dump.c_str(), "rb");
+        HeavyPOD item;
+        while (std::fread(&item, sizeof(HeavyPOD), 1, f) == 1) rebuilt.push_back(item);
+        std::fclose(f);
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    myMappedVector<HeavyPOD> reopened(path);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "    [Perf] restart " << N << " HeavyPOD: read + push_back "
+              << std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count() << "us, mmap reopen "
+              << std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count() << "us\n";
+    EXPECT_EQ(rebuilt.size(), reopened.size());
+    EXPECT_EQ(rebuilt[N - 1].data[0], reopened[N - 1].data[0]);
+    std::remove(path.c_str());
+    std::remove(dump.c_str());
+}
+
+#endif // __unix__ || __APPLE__
+
+#endif // TEST_MYMAPPEDVECTOR_HPP
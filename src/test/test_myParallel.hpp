@@ -0,0 +1,172 @@
+#ifndef TEST_MYPARALLEL_HPP
+#define TEST_MYPARALLEL_HPP
+
+#include "../test.h"
+#include "../myAlgorithm/myThreadPool.h"
+#include "../myAlgorithm/myParallel.h"
+#include "../myVector/myVector.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+using namespace TestHelpers;
+
+TEST(MyParallelTest, ThreadPoolBasics) {
+    std::atomic<int> done(0);
+    {
+        myThreadPool pool(3);
+        EXPECT_EQ(pool.size(), 3u);
+        for (int i = 0; i < 100; ++i) {
+            pool.submit([&done]() { done.fetch_add(1); });
+        }
+    }   // 析构时执行完所有已提交任务
+    EXPECT_EQ(done.load(), 100);
+
+    // 每个下标恰好被访问一次，包括末尾不满一块的部分
+    myThreadPool pool(4);
+    myVector<int> visits;
+    visits.resize(10007, 0);
+    pool.parallel_for(0, visits.size(), 64, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i) visits[i] ++;
+    });
+    EXPECT_TRUE(std::all_of(visits.begin(), visits.end(), [](int x) { return x == 1; }));
+
+    // 任务内部嵌套 parallel_for：等待的线程会帮忙执行任务，不会死锁
+    std::atomic<size_t> inner(0);
+    pool.parallel_for(0, 16, 1, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i) {
+            pool.parallel_for(0, 1000, 100, [&](size_t a, size_t b) { inner.fetch_add(b - a); });
+        }
+    });
+    EXPECT_EQ(inner.load(), 16000u);
+
+    // 块中抛出的异常在全部块完成后重新抛出
+    bool thrown = false;
+    try {
+        pool.parallel_for(0, 1000, 10, [](size_t lo, size_t) {
+            if (lo == 500) throw std::runtime_error("chunk failed");
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+
+    // 0 个工作线程：全部由调用线程执行
+    myThreadPool serial(0);
+    size_t sum = 0;
+    serial.parallel_for(0, 100, 7, [&](size_t lo, size_t hi) { sum += hi - lo; });
+    EXPECT_EQ(sum, 100u);
+}
+
+// 没有默认构造函数的累加类型
+struct ParallelSum {
+    long long value;
+    explicit ParallelSum(long long v) : value(v) {}
+    friend ParallelSum operator+(const ParallelSum& a, const ParallelSum& b) { return ParallelSum(a.value + b.value); }
+};
+
+TEST(MyParallelTest, Algorithms) {
+    myThreadPool pool(4);
+    std::mt19937 rng(17);
+    myVector<int> v;
+    for (int i = 0; i < 100003; ++i) v.push_back(static_cast<int>(rng() % 1000) - 500);
+
+    // for_each / transform
+    myVector<int> w = v;
+    parallel_for_each(pool, w, [](int& x) { x *= 2; }, 1000);
+    myVector<int> t;
+    t.resize(v.size());
+    parallel_transform(pool, v.begin(), v.end(), t.begin(), [](int x) { return x * 2; }, 333);
+    bool ok = true;
+    for (size_t i = 0; i < v.size(); ++i) ok = ok && w[i] == v[i] * 2 && t[i] == v[i] * 2;
+    EXPECT_TRUE(ok);
+
+    // reduce：不同块大小结果一致
+    long long ref = std::accumulate(v.begin(), v.end(), 0LL);
+    EXPECT_EQ(parallel_reduce(pool, v, 0LL), ref);
+    EXPECT_EQ(parallel_reduce(pool, v.begin(), v.end(), 0LL, std::plus<>(), 7), ref);
+    EXPECT_EQ(parallel_reduce(pool, v.begin(), v.begin(), 42LL), 42LL);
+    int maxv = parallel_reduce(pool, v.begin(), v.end(), v[0], [](int a, int b) { return std::max(a, b); });
+    EXPECT_EQ(maxv, *std::max_element(v.begin(), v.end()));
+
+    // inclusive_scan：异地与原地
+    myVector<long long> wide, scanned;
+    wide.assign(v.begin(), v.end());
+    scanned.resize(v.size());
+    std::vector<long long> expect(v.size());
+    std::partial_sum(wide.begin(), wide.end(), expect.begin());
+    parallel_inclusive_scan(pool, wide.begin(), wide.end(), scanned.begin(), std::plus<>(), 1000);
+    EXPECT_TRUE(std::equal(scanned.begin(), scanned.end(), expect.begin()));
+    parallel_inclusive_scan(pool, wide.begin(), wide.end(), wide.begin());
+    EXPECT_TRUE(std::equal(wide.begin(), wide.end(), expect.begin()));
+
+    // reduce / inclusive_scan 不要求元素类型可默认构造
+    std::vector<ParallelSum> sums;
+    for (int x : v) sums.emplace_back(x);
+    EXPECT_EQ(parallel_reduce(pool, sums.begin(), sums.end(), ParallelSum(0), std::plus<>(), 1000).value, ref);
+    parallel_inclusive_scan(pool, sums.begin(), sums.end(), sums.begin(), std::plus<>(), 1000);
+    EXPECT_EQ(sums.back().value, expect.back());
+    EXPECT_EQ(sums[12345].value, expect[12345]);
+
+    // copy_if：保持原顺序
+    myVector<int> out;
+    out.resize(v.size());
+    auto isEven = [](int x) { return x % 2 == 0; };
+    int* outEnd = parallel_copy_if(pool, v.begin(), v.end(), out.begin(), isEven, 999);
+    std::vector<int> refOut;
+    std::copy_if(v.begin(), v.end(), std::back_inserter(refOut), isEven);
+    EXPECT_EQ(static_cast<size_t>(outEnd - out.begin()), refOut.size());
+    EXPECT_TRUE(std::equal(refOut.begin(), refOut.end(), out.begin()));
+
+    // sort：段数为奇数时最后一段轮空进入下一轮
+    myThreadPool trio(2);     // concurrency() == 3
+    myVector<int> s = v;
+    parallel_sort(trio, s, std::less<>(), 1000);
+    std::vector<int> sorted(v.begin(), v.end());
+    std::sort(sorted.begin(), sorted.end());
+    EXPECT_TRUE(std::equal(s.begin(), s.end(), sorted.begin()));
+    parallel_sort(pool, s.begin(), s.end(), std::greater<>(), 1000);
+    EXPECT_TRUE(std::is_sorted(s.begin(), s.end(), std::greater<>()));
+}
+
+TEST(MyParallelTest, PerformanceScaling) {
+    const size_t N = 4000000;
+    myVector<double> in, out;
+    in.resize(N);
+    out.resize(N);
+    for (size_t i = 0; i < N; ++i) in[i] = static_cast<double>(i % 1000) * 0.001;
+    myVector<int> keys;
+    keys.reserve(N);
+    std::mt19937 rng(3);
+    for (size_t i = 0; i < N; ++i) keys.push_back(static_cast<int>(rng()));
+
+    auto ms = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count(); };
+    size_t maxThreads = std::max<size_t>(std::thread::hardware_concurrency(), 4);
+    double firstSum = 0;
+    bool consistent = true;
+    // 线程数 = 工作线程 + 调用线程
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        myThreadPool pool(threads - 1);
+        auto t0 = std::chrono::high_resolution_clock::now();
+        parallel_transform(pool, in.begin(), in.end(), out.begin(), [](double x) { return std::sqrt(x) * std::sin(x); });
+        auto t1 = std::chrono::high_resolution_clock::now();
+        double sum = parallel_reduce(pool, out, 0.0, std::plus<>(), N / 64);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        myVector<int> s = keys;
+        auto t3 = std::chrono::high_resolution_clock::now();
+        parallel_sort(pool, s);
+        auto t4 = std::chrono::high_resolution_clock::now();
+        if (threads == 1) firstSum = sum;
+        consistent = consistent && sum == firstSum && std::is_sorted(s.begin(), s.end());
+        std::cout << "    [Perf] " << threads << " thread(s), " << N << " elements: transform " << ms(t0, t1)
+                  << "ms, reduce " << ms(t1, t2) << "ms, sort " << ms(t3, t4) << "ms\n";
+    }
+    // 块大小固定时归约结果与线程数无关
+    EXPECT_TRUE(consistent);
+}
+
+#endif // TEST_MYPARALLEL_HPP
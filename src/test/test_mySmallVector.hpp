@@ -0,0 +1,180 @@
+#ifndef TEST_MYSMALLVECTOR_HPP
+#define TEST_MYSMALLVECTOR_HPP
+
+#include "../test.h"
+#include "../myVector/mySmallVector.h"
+#include "../myVector/myVector.h"
+#include "../myAllocator/myNodePoolAllocator.h"
+#include "../myAllocator/myPoolAllocator.h"
+
+using namespace TestHelpers;
+
+TEST(MySmallVectorTest, InlineThenSpill) {
+    using Alloc = DebugAllocator<int>;
+    Alloc::alloc_count = 0;
+    {
+        mySmallVector<int, 4, Alloc> v;
+        for (int i = 0; i < 4; ++i) v.push_back(i);
+        EXPECT_TRUE(v.is_small());
+        EXPECT_EQ(Alloc::alloc_count, 0); // 内联阶段零分配
+        v.push_back(4);                   // 溢出到堆
+        EXPECT_FALSE(v.is_small());
+        EXPECT_EQ(Alloc::alloc_count, 1);
+        EXPECT_EQ(v.size(), 5);
+        for (int i = 0; i < 5; ++i) {
+            EXPECT_EQ(v[i], i);
+        }
+        v.push_back(v[0]);                // 参数引用自身元素（可能触发扩容）
+        EXPECT_EQ(v.back(), 0);
+    }
+
+    mySmallVector<int, 8> s = {1, 2, 3};
+    s.insert(s.begin(), 0);               // 0 1 2 3
+    s.erase(s.begin() + 1, s.begin() + 3); // 0 3
+    EXPECT_EQ(s.size(), 2);
+    EXPECT_EQ(s[1], 3);
+    try {
+        s.at(5);
+        EXPECT_TRUE(false);
+    } catch (const std::out_of_range&) {
+        EXPECT_TRUE(true);
+    }
+}
+
+// 统计存活对象数，用于检查泄漏与重复析构（Obj 的 move_count 同时计入移动赋值，无法直接配平）
+struct LiveObj {
+    static int live;
+    int id;
+    LiveObj(int i) : id(i) { ++live; }
+    LiveObj(const LiveObj& o) : id(o.id) { ++live; }
+    LiveObj(LiveObj&& o) noexcept : id(o.id) { ++live; }
+    LiveObj& operator=(const LiveObj&) = default;
+    LiveObj& operator=(LiveObj&&) = default;
+    ~LiveObj() { --live; }
+};
+inline int LiveObj::live = 0;
+
+TEST(MySmallVectorTest, CopyMoveSwapLifecycle) {
+    LiveObj::live = 0;
+    {
+        mySmallVector<LiveObj, 2> a;
+        a.emplace_back(1);
+        a.emplace_back(2);
+        mySmallVector<LiveObj, 2> b = a;       // 内联拷贝
+        EXPECT_EQ(b.size(), 2);
+        EXPECT_EQ(b[1].id, 2);
+
+        mySmallVector<LiveObj, 2> c = std::move(a); // 内联：逐个移动
+        EXPECT_EQ(c[0].id, 1);
+        EXPECT_TRUE(a.empty());
+
+        b.emplace_back(3);            // b 溢出到堆
+        mySmallVector<LiveObj, 2> d = std::move(b); // 堆：直接接管指针
+        EXPECT_EQ(d.size(), 3);
+        EXPECT_TRUE(b.is_small());
+
+        c.swap(d);                          // 内联 <-> 堆
+        EXPECT_EQ(c.size(), 3);
+        EXPECT_EQ(d.size(), 2);
+        EXPECT_EQ(c[2].id, 3);
+        EXPECT_EQ(d[0].id, 1);
+
+        c.insert(c.begin() + 1, LiveObj(9));
+        EXPECT_EQ(c[1].id, 9);
+        EXPECT_EQ(c[2].id, 2);
+        c.erase(c.begin());
+        EXPECT_EQ(c[0].id, 9);
+        c.pop_back();
+        EXPECT_EQ(c.size(), 2);
+    }
+    EXPECT_EQ(LiveObj::live, 0);
+}
+
+TEST(MySmallVectorTest, AllocatorPropagation) {
+    // myNodePoolAllocator：移动 / 交换时传播。移动后的原对象仍持有可用的池
+    {
+        using Alloc = myNodePoolAllocator<std::string>;
+        mySmallVector<std::string, 2, Alloc> a;
+        for (int i = 0; i < 5; ++i) a.push_back(std::to_string(i));
+        mySmallVector<std::string, 2, Alloc> b = std::move(a);
+        EXPECT_EQ(b.size(), 5);
+        for (int i = 0; i < 5; ++i) a.push_back("x");      // 原对象的分配器未被掏空
+        EXPECT_EQ(a.size(), 5);
+
+        mySmallVector<std::string, 2, Alloc> small;
+        small.push_back("s");
+        a = std::move(small);           // a 在堆上、small 内联：a 的堆内存先由 a 原来的池释放
+        EXPECT_EQ(a.size(), 1);
+        EXPECT_TRUE(a.is_small());
+        a.swap(b);                      // 内联 <-> 堆
+        EXPECT_EQ(a.size(), 5);
+        EXPECT_EQ(b[0], "s");
+        EXPECT_EQ(a[4], "4");
+        for (int i = 0; i < 10; ++i) b.push_back("y");
+        EXPECT_EQ(b.size(), 11);
+    }
+    // myPoolAllocator：不传播。池不同时移动赋值只能逐元素移动，各自的内存回到各自的池
+    {
+        using Alloc = myPoolAllocator<std::string>;
+        myPool poolA, poolB;
+        mySmallVector<std::string, 2, Alloc> a(Alloc{poolA});
+        mySmallVector<std::string, 2, Alloc> b(Alloc{poolB});
+        for (int i = 0; i < 6; ++i) a.push_back(std::string(32, char('a' + i)));
+        b.push_back("b");
+        b = std::move(a);
+        EXPECT_TRUE(b.get_allocator() == Alloc{poolB});
+        EXPECT_EQ(b.size(), 6);
+        EXPECT_EQ(b[5], std::string(32, 'f'));
+        EXPECT_TRUE(a.empty());
+        for (int i = 0; i < 6; ++i) a.push_back("a");
+        b = a;
+        EXPECT_EQ(b.size(), 6);
+        EXPECT_TRUE(b.get_allocator() == Alloc{poolB});
+    }
+}
+
+TEST(MySmallVectorTest, AllocationBenchmark) {
+    // 对比 0~64 个元素时 myVector 与 mySmallVector<int, 8> 的分配次数与耗时
+    using VAlloc = DebugAllocator<int>;
+    const int rounds = 20000;
+    std::cout << "    [Perf] size | myVector allocs / ms | mySmallVector<8> allocs / ms\n";
+    for (int n : {0, 1, 2, 4, 8, 16, 32, 64}) {
+        // myVector<int> 会走 reallocate 扩展接口，一并计入
+        VAlloc::alloc_count = VAlloc::realloc_count = 0;
+        {
+            myVector<int, VAlloc> v;
+            for (int i = 0; i < n; ++i) v.push_back(i);
+        }
+        int vectorAllocs = VAlloc::alloc_count + VAlloc::realloc_count;
+        VAlloc::alloc_count = VAlloc::realloc_count = 0;
+        {
+            mySmallVector<int, 8, VAlloc> v;
+            for (int i = 0; i < n; ++i) v.push_back(i);
+        }
+        int smallAllocs = VAlloc::alloc_count + VAlloc::realloc_count;
+
+        long long sink = 0;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < rounds; ++r) {
+            myVector<int> v;
+            for (int i = 0; i < n; ++i) v.push_back(i);
+            sink += v.size();
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < rounds; ++r) {
+            mySmallVector<int, 8> v;
+            for (int i = 0; i < n; ++i) v.push_back(i);
+            sink += v.size();
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        std::cout << "    [Perf] " << std::setw(4) << n << " | "
+                  << std::setw(3) << vectorAllocs << " / " << std::setw(4)
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() << "         | "
+                  << std::setw(3) << smallAllocs << " / "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count() << "\n";
+        EXPECT_TRUE(smallAllocs <= vectorAllocs);
+        EXPECT_EQ(sink, 2LL * rounds * n);
+    }
+}
+
+#endif // TEST_MYSMALLVECTOR_HPP
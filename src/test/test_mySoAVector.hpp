@@ -0,0 +1,146 @@
+#ifndef TEST_MYSOAVECTOR_HPP
+#define TEST_MYSOAVECTOR_HPP
+
+#include "../test.h"
+#include "../myVector/mySoAVector.h"
+#include "../myVector/myVector.h"
+#include <string>
+
+using namespace TestHelpers;
+
+TEST(MySoAVectorTest, ColumnsAndRows) {
+    mySoAVector<int, double, std::string> v;
+    EXPECT_TRUE(v.empty());
+    for (int i = 0; i < 100; ++i) v.push_back(i, i * 0.5, std::to_string(i));
+    EXPECT_EQ(v.size(), 100);
+    EXPECT_TRUE(v.capacity() >= 100);
+
+    // 列视图是连续内存
+    auto ids = v.column<0>();
+    EXPECT_EQ(ids.size(), 100);
+    EXPECT_TRUE(&ids[99] == ids.data() + 99);
+    long sum = 0;
+    for (int x : ids) sum += x;
+    EXPECT_EQ(sum, 4950);
+
+    // 行代理：读写单个字段
+    v[10].get<1>() = 42.0;
+    v[10].get<2>() += "!";
+    EXPECT_TRUE(v.column<1>()[10] == 42.0);
+    EXPECT_EQ(v.at(10).get<2>(), std::string("10!"));
+    EXPECT_TRUE(v[3].value() == std::make_tuple(3, 1.5, std::string("3")));
+    bool thrown = false;
+    try {
+        v.at(100);
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+
+    int rows = 0;
+    for (auto row : v) { if (row.get<0>() == rows) ++rows; }
+    EXPECT_EQ(rows, 100);
+
+    const auto& cv = v;
+    EXPECT_EQ(cv[99].get<2>(), std::string("99"));
+    EXPECT_EQ(cv.column<2>()[0], std::string("0"));
+
+    v.pop_back();
+    EXPECT_EQ(v.size(), 99);
+    v.resize(120);
+    EXPECT_EQ(v.column<2>().size(), 120);
+    EXPECT_EQ(v[119].get<0>(), 0);
+    mySoAVector<int, double, std::string> copy = v;
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(copy.size(), 120);
+    EXPECT_EQ(copy[50].get<2>(), std::string("50"));
+
+    // 大小与容量取自各列：拷贝 / 移动后与列保持一致
+    mySoAVector<int, double, std::string> reserved;
+    reserved.reserve(8);
+    EXPECT_EQ(reserved.capacity(), 8);
+    mySoAVector<int, double, std::string> fresh;
+    fresh = reserved;                     // 拷贝得到的列不保留源对象的空闲容量
+    EXPECT_TRUE(fresh.empty());
+    EXPECT_EQ(fresh.capacity(), 0);
+    fresh.reserve(8);                     // 因此 reserve 不能被跳过
+    EXPECT_EQ(fresh.capacity(), 8);
+    for (int i = 0; i < 8; ++i) fresh.push_back(i, 0.0, "");
+    EXPECT_EQ(fresh.capacity(), 8);
+    mySoAVector<int, double, std::string> moved = std::move(v);
+    v.push_back(1, 1.0, "1");
+    moved = std::move(v);                 // 移动后的原对象为空，列视图长度为 0
+    EXPECT_EQ(v.size(), 0);
+    EXPECT_EQ(v.column<2>().size(), 0);
+    EXPECT_EQ(moved.size(), 1);
+    EXPECT_EQ(moved[0].get<2>(), std::string("1"));
+}
+
+namespace {
+    // 第 N 次拷贝时抛异常
+    struct ThrowingField {
+        int value = 0;
+        static int countdown;
+        ThrowingField() = default;
+        explicit ThrowingField(int v) : value(v) {}
+        ThrowingField(const ThrowingField& other) : value(other.value) {
+            if (countdown > 0 && -- countdown == 0) throw std::runtime_error("copy failed");
+        }
+        ThrowingField& operator=(const ThrowingField&) = default;
+    };
+    int ThrowingField::countdown = 0;
+}
+
+TEST(MySoAVectorTest, PushBackStrongGuarantee) {
+    mySoAVector<int, ThrowingField> v;
+    for (int i = 0; i < 3; ++i) v.push_back(i, ThrowingField(i));
+    ThrowingField::countdown = 1;
+    bool thrown = false;
+    try {
+        v.push_back(7, ThrowingField(7));
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+    ThrowingField::countdown = 0;
+    // 第一列已追加的元素被回滚，各列长度保持一致
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_EQ(v.column<0>().size(), 3);
+    EXPECT_EQ(v[2].get<0>(), 2);
+    EXPECT_EQ(v[2].get<1>().value, 2);
+    v.push_back(3, ThrowingField(3));
+    EXPECT_EQ(v[3].get<1>().value, 3);
+}
+
+TEST(MySoAVectorTest, PerformanceColumnScan) {
+    // 只扫描一个字段：AoS 每条 64B 记录只用到 8B，SoA 则连续读取
+    const int N = 2000000;
+    const int ROUNDS = 10;
+    myVector<HeavyPOD> aos;
+    mySoAVector<long, long, long, long, long, long, long, long> soa;
+    aos.reserve(N);
+    soa.reserve(N);
+    for (int i = 0; i < N; ++i) {
+        aos.push_back(HeavyPOD(i));
+        soa.push_back(i, i, i, i, i, i, i, i);
+    }
+
+    long aosSum = 0, soaSum = 0;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < ROUNDS; ++r) {
+        for (size_t i = 0; i < aos.size(); ++i) aosSum += aos[i].data[0];
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < ROUNDS; ++r) {
+        for (long x : soa.column<0>()) soaSum += x;
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    std::cout << "    [Perf] scan one field x" << N << " (" << ROUNDS << " rounds): AoS "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() << "ms, SoA "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count() << "ms\n";
+    EXPECT_EQ(aosSum, soaSum);
+}
+
+#endif // TEST_MYSOAVECTOR_HPP
@@ -0,0 +1,131 @@
+#ifndef TEST_MYSORT_HPP
+#define TEST_MYSORT_HPP
+
+#include "../test.h"
+#include "../myAlgorithm/mySort.h"
+#include "../myVector/myVector.h"
+#include "../myVector/intVector/intVector.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+
+using namespace TestHelpers;
+
+TEST(MySortTest, RadixSortIntegers) {
+    std::mt19937_64 rng(2024);
+    bool sorted = true;
+    // 覆盖插入排序阈值以下、跨越阈值、以及各种位宽与符号
+    const size_t sizes[] = { 0, 1, 2, 100, 257, 10000 };
+    for (size_t n : sizes) {
+        myVector<int> a;
+        myVector<uint64_t> b;
+        myVector<int16_t> c;
+        myVector<long long> d;
+        for (size_t i = 0; i < n; ++i) {
+            uint64_t r = rng();
+            a.push_back(static_cast<int>(r));
+            b.push_back(r);
+            c.push_back(static_cast<int16_t>(r >> 7));
+            d.push_back(static_cast<long long>(r % 2001) - 1000);   // 小范围：高位趟被跳过
+        }
+        std::vector<int> ra(a.begin(), a.end());
+        std::vector<long long> rd(d.begin(), d.end());
+        radix_sort(a);
+        radix_sort(b);
+        radix_sort(c);
+        radix_sort(d);
+        std::sort(ra.begin(), ra.end());
+        std::sort(rd.begin(), rd.end());
+        sorted = sorted && std::equal(a.begin(), a.end(), ra.begin()) && std::equal(d.begin(), d.end(), rd.begin());
+        sorted = sorted && std::is_sorted(b.begin(), b.end()) && std::is_sorted(c.begin(), c.end());
+    }
+    EXPECT_TRUE(sorted);
+
+    // intVector：迭代器即 int*
+    intVector iv;
+    for (int i = 0; i < 1000; ++i) iv.push_back((i * 7919) % 1000 - 500);
+    radix_sort(iv.begin(), iv.end());
+    EXPECT_TRUE(std::is_sorted(iv.begin(), iv.end()));
+    EXPECT_EQ(iv.front(), -500);
+
+    // 临时缓冲区来自容器的分配器
+    myVector<int, DebugAllocator<int>> dv;
+    dv.reserve(1000);
+    for (int i = 1000; i > 0; --i) dv.push_back(i);
+    int allocs = DebugAllocator<int>::alloc_count;
+    int deallocs = DebugAllocator<int>::dealloc_count;
+    radix_sort(dv);
+    EXPECT_EQ(DebugAllocator<int>::alloc_count, allocs + 1);
+    EXPECT_EQ(DebugAllocator<int>::dealloc_count, deallocs + 1);
+    EXPECT_EQ(dv[0], 1);
+    EXPECT_EQ(dv.back(), 1000);
+}
+
+TEST(MySortTest, RadixSortByKeyIsStable) {
+    myVector<HeavyPOD> records;
+    for (int i = 0; i < 5000; ++i) {
+        HeavyPOD r(i);
+        r.data[0] = (i * 37) % 100;           // 排序键，大量重复
+        records.push_back(r);
+    }
+    radix_sort_by_key(records, [](const HeavyPOD& r) { return r.data[0]; });
+    bool ok = true;
+    for (size_t i = 1; i < records.size(); ++i) {
+        const HeavyPOD& prev = records[i - 1];
+        const HeavyPOD& cur = records[i];
+        ok = ok && prev.data[0] <= cur.data[0];
+        if (prev.data[0] == cur.data[0]) ok = ok && prev.data[1] < cur.data[1];   // 稳定：原下标递增
+        ok = ok && cur.data[1] == cur.data[7];                                      // 记录整体搬运
+    }
+    EXPECT_TRUE(ok);
+}
+
+TEST(MySortTest, ParallelSort) {
+    std::mt19937 rng(5);
+    myVector<int> v;
+    for (int i = 0; i < 300000; ++i) v.push_back(static_cast<int>(rng()));
+    std::vector<int> ref(v.begin(), v.end());
+    std::sort(ref.begin(), ref.end());
+    // 线程数为奇数时，最后一段轮空进入下一轮
+    parallel_sort(v, std::less<>(), 3);
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), ref.begin()));
+
+    parallel_sort(v.begin(), v.end(), std::greater<>());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end(), std::greater<>()));
+
+    // 工作线程中的异常被重新抛出
+    bool thrown = false;
+    try {
+        parallel_sort(v.begin(), v.end(), [](int a, int b) {
+            if (a == b + 1) throw std::runtime_error("comparator failed");
+            return a < b;
+        }, 4);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+}
+
+TEST(MySortTest, PerformanceSort) {
+    const size_t N = 10000000;
+    std::mt19937 rng(11);
+    myVector<int> base;
+    base.reserve(N);
+    for (size_t i = 0; i < N; ++i) base.push_back(static_cast<int>(rng()));
+
+    auto ms = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count(); };
+    myVector<int> a = base, b = base, c = base;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    std::sort(a.begin(), a.end());
+    auto t1 = std::chrono::high_resolution_clock::now();
+    radix_sort(b);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    parallel_sort(c);
+    auto t3 = std::chrono::high_resolution_clock::now();
+    std::cout << "    [Perf] sort " << N << " ints: std::sort " << ms(t0, t1) << "ms, radix_sort " << ms(t1, t2)
+              << "ms, parallel_sort (" << std::thread::hardware_concurrency() << " threads) " << ms(t2, t3) << "ms\n";
+    EXPECT_TRUE(std::equal(a.begin(), a.end(), b.begin()));
+    EXPECT_TRUE(std::equal(a.begin(), a.end(), c.begin()));
+}
+
+#endif // TEST_MYSORT_HPP
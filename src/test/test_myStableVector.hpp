@@ -0,0 +1,117 @@
+#ifndef TEST_MYSTABLEVECTOR_HPP
+#define TEST_MYSTABLEVECTOR_HPP
+
+#include "../test.h"
+#include "../myVector/myStableVector.h"
+#include "../myVector/myVector.h"
+#include "../myAllocator/myPoolAllocator.h"
+#include <algorithm>
+
+using namespace TestHelpers;
+
+TEST(MyStableVectorTest, StableAddresses) {
+    myStableVector<int> v;
+    v.push_back(0);
+    int* first = &v[0];
+    std::vector<int*> addrs;
+    for (int i = 1; i < 10000; ++i) {
+        v.push_back(i);
+        if (i % 1000 == 0) addrs.push_back(&v[i]);
+    }
+    EXPECT_EQ(v.size(), 10000);
+    EXPECT_TRUE(first == &v[0]);          // 扩容后地址不变
+    for (size_t k = 0; k < addrs.size(); ++k) {
+        EXPECT_TRUE(addrs[k] == &v[(k + 1) * 1000]);
+    }
+    for (int i = 0; i < 10000; ++i) {
+        if (v[i] != i) { EXPECT_EQ(v[i], i); break; }
+    }
+    EXPECT_TRUE(v.capacity() >= v.size());
+
+    // 随机访问迭代器可直接用于标准算法
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+    EXPECT_EQ(v.end() - v.begin(), 10000);
+    EXPECT_TRUE(std::binary_search(v.begin(), v.end(), 4321));
+
+    v.push_back(v[0]);                      // 引用自身元素
+    EXPECT_EQ(v.back(), 0);
+    v.pop_back();
+    EXPECT_EQ(v.back(), 9999);
+}
+
+TEST(MyStableVectorTest, CopyMoveLifecycle) {
+    Obj::resetStats();
+    {
+        myStableVector<Obj> a;
+        for (int i = 0; i < 40; ++i) a.emplace_back("o", i);
+        myStableVector<Obj> b = a;
+        EXPECT_EQ(b.size(), 40);
+        EXPECT_EQ(b[39].id, 39);
+        myStableVector<Obj> c = std::move(a);
+        EXPECT_TRUE(a.empty());
+        EXPECT_EQ(c[17].id, 17);
+        a = c;
+        EXPECT_EQ(a.at(20).id, 20);
+    }
+    // 分段存储从不搬迁：没有任何 move
+    EXPECT_EQ(Obj::move_count, 0);
+    EXPECT_EQ(Obj::construct_count + Obj::copy_count, Obj::destruct_count);
+}
+
+TEST(MyStableVectorTest, NonPropagatingAllocator) {
+    // myPoolAllocator 不随赋值传播：段必须始终由分配它的池回收（池不同则逐元素拷贝 / 移动）
+    using Alloc = myPoolAllocator<std::string>;
+    myPool poolA, poolB;
+    myStableVector<std::string, Alloc> a{Alloc(poolA)};
+    myStableVector<std::string, Alloc> b{Alloc(poolB)};
+    for (int i = 0; i < 100; ++i) a.push_back(std::string(32, char('a' + i % 26)));
+    b.push_back("b");
+    b = a;
+    EXPECT_EQ(b.size(), 100);
+    EXPECT_EQ(b[99], a[99]);
+    b = std::move(a);
+    EXPECT_EQ(b.size(), 100);
+    EXPECT_TRUE(a.empty());
+    for (int i = 0; i < 100; ++i) a.push_back("a");
+    for (int i = 0; i < 100; ++i) b.push_back("b");
+    EXPECT_EQ(b.size(), 200);
+
+    // 池相同时移动赋值直接接管段：元素地址不变
+    myStableVector<std::string, Alloc> c{Alloc(poolB)};
+    std::string* first = &b[0];
+    c = std::move(b);
+    EXPECT_TRUE(&c[0] == first);
+    // 移动构造后原对象仍可使用
+    myStableVector<std::string, Alloc> d(std::move(c));
+    c.push_back("c");
+    EXPECT_EQ(c.size(), 1);
+    EXPECT_EQ(d.size(), 200);
+}
+
+TEST(MyStableVectorTest, PushBackTailLatency) {
+    // 对比 push_back 单次最坏耗时：myVector 在扩容时需要搬迁全部元素
+    const int N = 2000000;
+    auto worst = [&](auto& v) {
+        long long maxNs = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < N; ++i) {
+            auto t0 = std::chrono::high_resolution_clock::now();
+            v.push_back(HeavyPOD(i));
+            auto t1 = std::chrono::high_resolution_clock::now();
+            long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+            if (ns > maxNs) maxNs = ns;
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::make_pair(maxNs, std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+    };
+    myVector<HeavyPOD> vec;
+    myStableVector<HeavyPOD> stable;
+    auto rv = worst(vec);
+    auto rs = worst(stable);
+    std::cout << "    [Perf] push_back x" << N << " HeavyPOD worst: myVector " << rv.first / 1000
+              << "us (" << rv.second << "ms total), myStableVector " << rs.first / 1000
+              << "us (" << rs.second << "ms total)\n";
+    EXPECT_EQ(vec.size(), stable.size());
+}
+
+#endif // TEST_MYSTABLEVECTOR_HPP
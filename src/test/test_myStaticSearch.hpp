@@ -0,0 +1,95 @@
+#ifndef TEST_MYSTATICSEARCH_HPP
+#define TEST_MYSTATICSEARCH_HPP
+
+#include "../test.h"
+#include "../myAlgorithm/myStaticSearch.h"
+#include "../myVector/myVector.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+
+using namespace TestHelpers;
+
+TEST(MyStaticSearchTest, MatchesStdLowerBound) {
+    std::mt19937 rng(77);
+    bool ok = true;
+    // 覆盖空、单元素、恰好满层 (2^k - 1)、满节点 (16k) 以及不规则大小
+    for (size_t n : { 0, 1, 2, 3, 7, 15, 16, 17, 100, 255, 256, 1000, 4097 }) {
+        myVector<int32_t> sorted;
+        for (size_t i = 0; i < n; ++i) sorted.push_back(static_cast<int32_t>(rng() % (n * 3 + 1)) - 10);
+        std::sort(sorted.begin(), sorted.end());      // 含重复值
+        myEytzingerIndex<int32_t> eytz(sorted);
+        myStaticBTree<int32_t> stree(sorted);
+        ok = ok && eytz.size() == n && stree.size() == n;
+
+        myVector<int32_t> keys;
+        for (int32_t q = -12; q <= static_cast<int32_t>(n * 3) + 2; ++q) keys.push_back(q);
+        keys.push_back(std::numeric_limits<int32_t>::max());
+        keys.push_back(std::numeric_limits<int32_t>::min());
+        myVector<const int32_t*> batch;
+        batch.resize(keys.size());
+        eytz.lower_bound_batch(keys.begin(), keys.size(), batch.begin());
+
+        for (size_t i = 0; i < keys.size(); ++i) {
+            int32_t q = keys[i];
+            const int32_t* ref = std::lower_bound(sorted.begin(), sorted.end(), q);
+            const int32_t* e = eytz.lower_bound(q);
+            const int32_t* s = stree.lower_bound(q);
+            if (ref == sorted.end()) {
+                ok = ok && e == nullptr && s == nullptr && batch[i] == nullptr;
+            } else {
+                ok = ok && e != nullptr && *e == *ref && s != nullptr && *s == *ref && batch[i] == e;
+            }
+            bool present = ref != sorted.end() && *ref == q;
+            ok = ok && eytz.contains(q) == present && stree.contains(q) == present;
+        }
+    }
+    EXPECT_TRUE(ok);
+
+    // 未排序输入会先排序；自定义比较器
+    myVector<int> unsorted = { 5, 1, 4, 2, 3 };
+    myEytzingerIndex<int, std::greater<int>> desc(unsorted, std::greater<int>());
+    EXPECT_EQ(*desc.lower_bound(10), 5);            // 降序下第一个 "不大于" 10 的元素
+    EXPECT_EQ(*desc.lower_bound(3), 3);
+    EXPECT_TRUE(desc.lower_bound(0) == nullptr);
+    myStaticBTree<double> dtree(myVector<double>{ 2.5, 0.5, 1.5 });
+    EXPECT_TRUE(*dtree.lower_bound(1.0) == 1.5);
+}
+
+TEST(MyStaticSearchTest, PerformanceLookup) {
+    const size_t N = 16000000;
+    const size_t Q = 2000000;
+    std::mt19937 rng(2025);
+    myVector<int32_t> sorted;
+    sorted.reserve(N);
+    for (size_t i = 0; i < N; ++i) sorted.push_back(static_cast<int32_t>(i * 3));
+    myVector<int32_t> queries;
+    for (size_t i = 0; i < Q; ++i) queries.push_back(static_cast<int32_t>(rng() % (N * 3 - 2)));
+
+    myEytzingerIndex<int32_t> eytz(sorted);
+    myStaticBTree<int32_t> stree(sorted);
+    myVector<const int32_t*> out;
+    out.resize(Q);
+
+    auto ms = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count(); };
+    long long s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int32_t q : queries) s0 += *std::lower_bound(sorted.begin(), sorted.end(), q);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int32_t q : queries) s1 += *eytz.lower_bound(q);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    eytz.lower_bound_batch(queries.begin(), Q, out.begin());
+    for (size_t i = 0; i < Q; ++i) s2 += *out[i];
+    auto t3 = std::chrono::high_resolution_clock::now();
+    for (int32_t q : queries) s3 += *stree.lower_bound(q);
+    auto t4 = std::chrono::high_resolution_clock::now();
+
+    std::cout << "    [Perf] " << Q << " lookups in " << N << " ints: std::lower_bound " << ms(t0, t1)
+              << "ms, eytzinger " << ms(t1, t2) << "ms, eytzinger batch " << ms(t2, t3)
+              << "ms, s-tree " << ms(t3, t4) << "ms\n";
+    EXPECT_EQ(s0, s1);
+    EXPECT_EQ(s0, s2);
+    EXPECT_EQ(s0, s3);
+}
+
+#endif // TEST_MYSTATICSEARCH_HPP
@@ -0,0 +1,260 @@
+#ifndef TEST_MYUNROLLEDLIST_HPP
+#define TEST_MYUNROLLEDLIST_HPP
+
+#include "../test.h"
+#include "../myList/myUnrolledList.h"
+#include "../myList/myList.h"
+#include "../myVector/myVector.h"
+#include "../myAllocator/myNodePoolAllocator.h"
+#include "../myAllocator/myPoolAllocator.h"
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace TestHelpers;
+
+template <typename L>
+static bool unrolledMatches(const L& list, const std::list<int>& ref) {
+    if (list.size() != ref.size()) return false;
+    if (!std::equal(list.begin(), list.end(), ref.begin(), ref.end())) return false;
+    // 反向遍历同样一致
+    auto it = list.end();
+    for (auto r = ref.rbegin(); r != ref.rend(); ++r) {
+        --it;
+        if (*it != *r) return false;
+    }
+    return it == list.begin();
+}
+
+TEST(MyUnrolledListTest, RandomOperationsMatchStdList) {
+    // 小节点（node_capacity == 4）让分裂 / 合并频繁发生
+    using Small = myUnrolledList<int, std::allocator<int>, 16>;
+    EXPECT_EQ(Small::node_capacity, 4);
+    Small list;
+    std::list<int> ref;
+    std::mt19937 rng(23);
+    bool ok = true;
+    for (int step = 0; step < 20000; ++step) {
+        int op = static_cast<int>(rng() % 6);
+        if (op <= 1 || ref.empty()) {
+            size_t pos = rng() % (ref.size() + 1);
+            auto it = list.begin();
+            std::advance(it, pos);
+            auto rit = ref.begin();
+            std::advance(rit, pos);
+            auto inserted = list.insert(it, step);
+            ref.insert(rit, step);
+            ok = ok && *inserted == step;
+        } else if (op == 2) {
+            size_t pos = rng() % ref.size();
+            auto it = list.begin();
+            std::advance(it, pos);
+            auto rit = ref.begin();
+            std::advance(rit, pos);
+            auto next = list.erase(it);
+            auto rnext = ref.erase(rit);
+            ok = ok && ((rnext == ref.end()) ? next == list.end() : *next == *rnext);
+        } else if (op == 3) {
+            list.push_front(step);
+            ref.push_front(step);
+        } else if (op == 4) {
+            list.pop_back();
+            ref.pop_back();
+        } else {
+            list.pop_front();
+            ref.pop_front();
+        }
+        if (step % 500 == 0) ok = ok && unrolledMatches(list, ref);
+    }
+    EXPECT_TRUE(ok);
+    EXPECT_TRUE(unrolledMatches(list, ref));
+    EXPECT_TRUE(list.node_count() <= list.size());
+
+    // 顺序 push_back 使节点满载
+    myUnrolledList<int> dense;
+    for (int i = 0; i < 10000; ++i) dense.push_back(i);
+    size_t cap = myUnrolledList<int>::node_capacity;
+    EXPECT_EQ(dense.node_count(), (10000 + cap - 1) / cap);
+    EXPECT_EQ(dense.front(), 0);
+    EXPECT_EQ(dense.back(), 9999);
+    // 删掉大部分元素后节点被合并 / 释放
+    dense.remove_if([](int x) { return x % 10 != 0; });
+    EXPECT_EQ(dense.size(), 1000);
+    EXPECT_TRUE(dense.node_count() * cap < 10000);
+    std::list<int> tens;
+    for (int i = 0; i < 10000; i += 10) tens.push_back(i);
+    EXPECT_TRUE(unrolledMatches(dense, tens));
+}
+
+TEST(MyUnrolledListTest, ListOperationsAndLifetime) {
+    myUnrolledList<int, std::allocator<int>, 32> list;
+    for (int i = 0; i < 200; ++i) list.push_back(i % 7);
+    list.sort();
+    EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+    EXPECT_EQ(list.unique(), 193);
+    std::list<int> ref = {0, 1, 2, 3, 4, 5, 6};
+    EXPECT_TRUE(unrolledMatches(list, ref));
+    EXPECT_EQ(list.remove(list.front()), 1);   // 参数引用链表中的元素
+    list.sort(std::greater<>());
+    ref = {6, 5, 4, 3, 2, 1};
+    EXPECT_TRUE(unrolledMatches(list, ref));
+
+    // 拷贝 / 移动 / 交换（哨兵内嵌在对象中，转移后首尾节点指向新的哨兵）
+    auto copy = list;
+    decltype(list) moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_TRUE(unrolledMatches(moved, ref));
+    decltype(list) other;
+    other.push_back(42);
+    other.swap(moved);
+    EXPECT_TRUE(unrolledMatches(other, ref));
+    EXPECT_EQ(*moved.begin(), 42);
+    moved = other;
+    EXPECT_TRUE(unrolledMatches(moved, ref));
+    other = std::move(moved);
+    moved.push_back(1);
+    EXPECT_EQ(moved.size(), 1);
+    EXPECT_TRUE(unrolledMatches(other, ref));
+
+    // 非平凡类型（泄漏 / 重复析构由 ASan 构建检查）；emplace 的参数引用本链表元素也安全
+    {
+        myUnrolledList<Obj, std::allocator<Obj>, 128> objs;
+        for (int i = 0; i < 100; ++i) objs.emplace_back("o", i);
+        auto it = objs.begin();
+        std::advance(it, 50);
+        objs.insert(it, objs.front());
+        it = objs.begin();
+        std::advance(it, 50);
+        EXPECT_EQ(it->id, 0);
+        objs.remove_if([](const Obj& o) { return o.id % 3 == 0; });
+        EXPECT_EQ(objs.size(), 66);
+        objs.sort([](const Obj& l, const Obj& r) { return l.id > r.id; });
+        EXPECT_EQ(objs.front().id, 98);
+    }
+
+    // 节点通过 rebind 后的分配器申请
+    myUnrolledList<int, myNodePoolAllocator<int>> pooled;
+    for (int i = 0; i < 1000; ++i) pooled.push_front(i);
+    EXPECT_EQ(pooled.front(), 999);
+    EXPECT_EQ(pooled.get_allocator().pool->slot_size() % 8, 0);
+
+    // 移动后的链表仍持有可用的分配器，可以继续插入
+    myUnrolledList<int, myNodePoolAllocator<int>> stolen(std::move(pooled));
+    EXPECT_EQ(stolen.size(), 1000);
+    pooled.push_back(7);
+    EXPECT_EQ(pooled.front(), 7);
+    myUnrolledList<int, myNodePoolAllocator<int>> assigned;
+    assigned = std::move(stolen);
+    stolen.push_back(8);
+    EXPECT_EQ(stolen.size(), 1);
+    EXPECT_EQ(assigned.size(), 1000);
+    assigned = pooled;
+    assigned.push_back(9);
+    EXPECT_EQ(assigned.back(), 9);
+}
+
+// 第 throw_after 次移动构造时抛异常
+struct ThrowingMove {
+    static int live;
+    static int throw_after;
+    int id;
+    explicit ThrowingMove(int i) : id(i) { ++live; }
+    ThrowingMove(const ThrowingMove& other) : id(other.id) { ++live; }
+    ThrowingMove(ThrowingMove&& other) : id(other.id) {
+        if (throw_after > 0 && --throw_after == 0) throw std::runtime_error("move");
+        ++live;
+    }
+    ThrowingMove& operator=(const ThrowingMove&) = default;
+    ThrowingMove& operator=(ThrowingMove&&) = default;
+    ~ThrowingMove() { --live; }
+};
+inline int ThrowingMove::live = 0;
+inline int ThrowingMove::throw_after = 0;
+
+TEST(MyUnrolledListTest, AllocatorAndExceptionSafety) {
+    // myPoolAllocator 不随移动赋值传播：池不同时逐元素移动，节点各自回收到自己的池
+    {
+        using Alloc = myPoolAllocator<std::string>;
+        myPool poolA, poolB;
+        myUnrolledList<std::string, Alloc> a{Alloc(poolA)};
+        myUnrolledList<std::string, Alloc> b{Alloc(poolB)};
+        for (int i = 0; i < 100; ++i) a.push_back(std::string(32, char('a' + i % 26)));
+        b.push_back("b");
+        b = std::move(a);
+        EXPECT_TRUE(b.get_allocator() == Alloc(poolB));
+        EXPECT_EQ(b.size(), 100);
+        EXPECT_TRUE(a.empty());
+        for (int i = 0; i < 100; ++i) a.push_back("a");
+        for (int i = 0; i < 100; ++i) b.push_front("b");
+        EXPECT_EQ(b.size(), 200);
+        EXPECT_EQ(b.back(), std::string(32, char('a' + 99 % 26)));
+    }
+    // 满节点分裂时移动构造抛异常：新节点被回收，计数与元素个数保持一致，没有重复的元素
+    ThrowingMove::live = 0;
+    {
+        using List = myUnrolledList<ThrowingMove>;
+        List list;
+        for (size_t i = 0; i < List::node_capacity; ++i) list.emplace_back(int(i));
+        EXPECT_EQ(list.node_count(), 1);
+        auto it = list.begin();
+        std::advance(it, 3);
+        ThrowingMove::throw_after = 5;
+        bool thrown = false;
+        try {
+            list.emplace(it, -1);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        ThrowingMove::throw_after = 0;
+        EXPECT_TRUE(thrown);
+        EXPECT_EQ(list.node_count(), 1);
+        EXPECT_EQ(list.size(), List::node_capacity);
+        EXPECT_EQ(size_t(std::distance(list.begin(), list.end())), list.size());
+        EXPECT_EQ(ThrowingMove::live, int(List::node_capacity));
+        list.emplace(list.begin(), -2);         // 之后仍可正常插入
+        EXPECT_EQ(list.front().id, -2);
+    }
+    EXPECT_EQ(ThrowingMove::live, 0);
+}
+
+TEST(MyUnrolledListTest, PerformanceScan) {
+    const int n = 1000000, passes = 20;
+    std::mt19937 rng(9);
+    myList<int> list;
+    myUnrolledList<int> unrolled;
+    myVector<int> vec;
+    for (int i = 0; i < n; ++i) {
+        int v = static_cast<int>(rng() % 1000);
+        list.push_back(v);
+        unrolled.push_back(v);
+        vec.push_back(v);
+    }
+    // 排序后 myList 的遍历顺序与节点的内存顺序无关，模拟长期增删后的离散堆布局
+    list.sort();
+    unrolled.sort();
+    std::sort(vec.begin(), vec.end());
+
+    auto ms = [](auto a, auto b) { return std::chrono::duration_cast<std::chrono::milliseconds>(b - a).count(); };
+    long long s1 = 0, s2 = 0, s3 = 0;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int p = 0; p < passes; ++p) for (auto it = list.begin(); it != list.end(); ++it) s1 += *it;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int p = 0; p < passes; ++p) for (int x : unrolled) s2 += x;
+    auto t2 = std::chrono::high_resolution_clock::now();
+    for (int p = 0; p < passes; ++p) for (int x : vec) s3 += x;
+    auto t3 = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(s1, s2);
+    EXPECT_EQ(s2, s3);
+
+    double listBytes = static_cast<double>(sizeof(ListNode<int>));
+    double unrolledBytes = static_cast<double>(unrolled.node_count()) * 256 / n;
+    std::cout << "    [Perf] scan " << n << " ints x" << passes << ": myList " << ms(t0, t1) << "ms, myUnrolledList "
+              << ms(t1, t2) << "ms, myVector " << ms(t2, t3) << "ms; bytes/element: myList " << listBytes
+              << " (+malloc header), myUnrolledList " << unrolledBytes << "\n";
+}
+
+#endif // TEST_MYUNROLLEDLIST_HPP
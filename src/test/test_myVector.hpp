@@ -3,7 +3,10 @@
 
 #include "../test.h"
 #include "../myVector/myVector.h"
+#include "../myAllocator/myMallocAllocator.h"
 #include <vector>
+#include <sstream>
+#include <iterator>
 
 using namespace TestHelpers;
 
@@ -65,6 +68,36 @@ TEST(MyVectorTest, ReserveAndResize) {
     EXPECT_EQ(v[0], 42); // 数据保留
 }
 
+TEST(MyVectorTest, DefaultInitAndOverwrite) {
+    myVector<int> v = {1, 2};
+    v.resize_default_init(5);     // 新元素不清零，保留原有元素
+    EXPECT_EQ(v.size(), 5);
+    EXPECT_EQ(v[1], 2);
+    v.resize_default_init(1);
+    EXPECT_EQ(v.size(), 1);
+
+    // 模拟 read()：请求 8 个，实际写入 6 个
+    v.resize_and_overwrite(8, [](int* data, size_t n) {
+        EXPECT_EQ(n, 8);
+        for (size_t i = 1; i < 6; ++i) data[i] = static_cast<int>(i * 10);
+        return size_t(6);
+    });
+    EXPECT_EQ(v.size(), 6);
+    EXPECT_EQ(v[0], 1);           // 已有元素原样交给 op
+    EXPECT_EQ(v[5], 50);
+
+    try {
+        v.resize_and_overwrite(2, [](int*, size_t) { return size_t(3); });
+        EXPECT_TRUE(false);
+    } catch (const std::length_error&) {
+        EXPECT_TRUE(true);
+    }
+
+    myVector<std::string> s;
+    s.resize_default_init(3);     // 非平凡类型仍会调用默认构造
+    EXPECT_EQ(s[2], "");
+}
+
 TEST(MyVectorTest, ObjectLifecycleParams) {
     // 使用 TestHelpers::Obj 跟踪构造/析构
     Obj::resetStats();
@@ -116,6 +149,196 @@ TEST(MyVectorTest, InsertAndErase) {
     EXPECT_EQ(v[1], 2);
 }
 
+// 用户显式声明为可重定位的非平凡类型：仅持有独占指针
+struct RelocatableBox {
+    std::unique_ptr<int> p;
+    explicit RelocatableBox(int v) : p(std::make_unique<int>(v)) {}
+};
+template <> struct is_trivially_relocatable<RelocatableBox> : std::true_type {};
+
+TEST(MyVectorTest, RelocatableInsertAndErase) {
+    // 平凡类型：走 memmove 快速路径
+    myVector<HeavyPOD> pods;
+    for (int i = 0; i < 5; ++i) pods.push_back(HeavyPOD(i)); // 0 1 2 3 4
+    pods.insert(pods.begin() + 1, HeavyPOD(9));             // 0 9 1 2 3 4
+    EXPECT_EQ(pods.size(), 6);
+    EXPECT_EQ(pods[1].data[0], 9);
+    EXPECT_EQ(pods[5].data[7], 4);
+    pods.erase(pods.begin());                                // 9 1 2 3 4
+    pods.erase(pods.begin() + 1, pods.begin() + 3);          // 9 3 4
+    EXPECT_EQ(pods.size(), 3);
+    EXPECT_EQ(pods[0].data[0], 9);
+    EXPECT_EQ(pods[1].data[0], 3);
+    EXPECT_EQ(pods[2].data[0], 4);
+
+    // 用户特化的可重定位类型：搬迁后旧副本不析构，指针不应被重复释放
+    myVector<RelocatableBox> boxes;
+    for (int i = 0; i < 5; ++i) boxes.emplace_back(i);       // 0 1 2 3 4 (含扩容)
+    boxes.insert(boxes.begin(), RelocatableBox(7));          // 7 0 1 2 3 4
+    EXPECT_EQ(*boxes[0].p, 7);
+    EXPECT_EQ(*boxes[5].p, 4);
+    boxes.erase(boxes.begin() + 2, boxes.end() - 1);         // 7 0 4
+    EXPECT_EQ(boxes.size(), 3);
+    EXPECT_EQ(*boxes[1].p, 0);
+    EXPECT_EQ(*boxes[2].p, 4);
+}
+
+TEST(MyVectorTest, SelfRangeInsert) {
+    // 容量充足：尾部先被搬移，源区间必须在搬移前读出
+    myVector<int> v = {1, 2, 3, 4};
+    v.reserve(16);
+    v.insert(v.begin(), v.begin() + 2, v.end());
+    int expected[] = {3, 4, 1, 2, 3, 4};
+    EXPECT_EQ(v.size(), 6);
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), expected));
+
+    // 需要扩容：旧内存释放前源区间已被读出
+    myVector<int> w = {1, 2, 3};
+    w.shrink_to_fit();
+    w.insert(w.begin() + 1, w.begin(), w.end());
+    int expectedW[] = {1, 1, 2, 3, 2, 3};
+    EXPECT_TRUE(std::equal(w.begin(), w.end(), expectedW));
+
+    // 非平凡类型走旋转路径
+    myVector<std::string> s = {"a", "b", "c"};
+    s.reserve(8);
+    s.insert(s.begin() + 1, s.begin(), s.end());
+    std::string expectedS[] = {"a", "a", "b", "c", "b", "c"};
+    EXPECT_TRUE(std::equal(s.begin(), s.end(), expectedS));
+}
+
+TEST(MyVectorTest, RangeInsertAndAssign) {
+    myVector<int> v = {1, 2, 3};
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_EQ(v[2], 3);
+
+    // insert(pos, n, value)：整数参数不能被迭代器版本截胡
+    v.insert(v.begin() + 1, 3, 7);                  // 1 7 7 7 2 3
+    EXPECT_EQ(v.size(), 6);
+    EXPECT_EQ(v[3], 7);
+    EXPECT_EQ(v[4], 2);
+
+    // insert(pos, first, last)：前向迭代器
+    std::vector<int> src = {10, 11, 12};
+    v.insert(v.end(), src.begin(), src.end());      // 1 7 7 7 2 3 10 11 12
+    EXPECT_EQ(v.size(), 9);
+    EXPECT_EQ(v[8], 12);
+
+    // value 引用自身元素
+    v.insert(v.begin(), 2, v[8]);                   // 12 12 1 7 ...
+    EXPECT_EQ(v[0], 12);
+    EXPECT_EQ(v[2], 1);
+
+    // 输入迭代器：只能遍历一次
+    std::istringstream in("4 5 6");
+    v.insert(v.begin() + 2, std::istream_iterator<int>(in), std::istream_iterator<int>());
+    EXPECT_EQ(v[2], 4);
+    EXPECT_EQ(v[4], 6);
+    EXPECT_EQ(v[5], 1);
+
+    v.assign({9, 8});
+    EXPECT_EQ(v.size(), 2);
+    EXPECT_EQ(v[1], 8);
+
+    v.append_range(src);
+    EXPECT_EQ(v.size(), 5);
+    EXPECT_EQ(v[4], 12);
+
+    // 非平凡类型：先尾部构造再旋转
+    myVector<std::string> s = {"a", "d"};
+    std::vector<std::string> mid = {"b", "c"};
+    s.insert(s.begin() + 1, mid.begin(), mid.end());
+    EXPECT_EQ(s.size(), 4);
+    EXPECT_EQ(s[1], "b");
+    EXPECT_EQ(s[3], "d");
+    s.insert(s.begin(), 2, std::string("z"));
+    EXPECT_EQ(s[1], "z");
+    EXPECT_EQ(s[2], "a");
+}
+
+TEST(MyVectorTest, RangeInsertSingleAllocation) {
+    // 批量导入只分配一次
+    using Alloc = DebugAllocator<int>;
+    std::vector<int> batch(1000, 1);
+    Alloc::alloc_count = 0;
+    {
+        myVector<int, Alloc> v;
+        v.insert(v.end(), batch.begin(), batch.end());
+        EXPECT_EQ(Alloc::alloc_count, 1);
+        EXPECT_EQ(v.size(), 1000);
+        v.assign(batch.begin(), batch.begin() + 10); // 容量足够，不再分配
+        EXPECT_EQ(Alloc::alloc_count, 1);
+    }
+
+    // 非平凡类型扩容路径：元素数量与顺序正确，无泄漏
+    Obj::resetStats();
+    {
+        myVector<Obj> v;
+        v.emplace_back("x", 0);
+        v.emplace_back("y", 3);
+        std::vector<Obj> mid;
+        mid.emplace_back("m", 1);
+        mid.emplace_back("n", 2);
+        v.insert(v.begin() + 1, mid.begin(), mid.end());
+        EXPECT_EQ(v.size(), 4);
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(v[i].id, i);
+        }
+    }
+    EXPECT_EQ(Obj::construct_count + Obj::copy_count + Obj::move_count, Obj::destruct_count);
+}
+
+TEST(MyVectorTest, GrowthPolicy) {
+    myVector<int, std::allocator<int>, myGrowthOneAndHalf> v;
+    size_t lastCap = 0, reallocs = 0;
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(i);
+        if (v.capacity() != lastCap) {
+            // 每次扩容不超过 1.5 倍（起步阶段 +1）
+            EXPECT_TRUE(lastCap < 2 || v.capacity() <= lastCap + lastCap / 2);
+            lastCap = v.capacity();
+            ++reallocs;
+        }
+    }
+    EXPECT_EQ(v[99], 99);
+    EXPECT_TRUE(reallocs > 7); // 比 2 倍策略扩容次数多
+    EXPECT_EQ(v.wasted_bytes(), (v.capacity() - v.size()) * sizeof(int));
+
+    myVector<int, std::allocator<int>, myGrowthFixedStep<16>> f;
+    f.resize(5);
+    EXPECT_EQ(f.capacity(), 16);
+    f.resize(40);
+    EXPECT_EQ(f.capacity(), 40); // 步长不足时至少满足需求
+
+    // 超过一页后按 4KB 取整
+    myVector<int, std::allocator<int>, myGrowthPageRounded<>> p;
+    p.resize(1500);
+    p.push_back(1);
+    EXPECT_EQ(p.capacity() * sizeof(int) % 4096, 0);
+}
+
+TEST(MyVectorTest, GrowthPolicyWaste) {
+    // 对比各策略在相同负载下的扩容次数与浪费内存
+    const size_t N = 1000000;
+    auto report = [](const char* name, auto& v, size_t n) {
+        size_t reallocs = 0, lastCap = 0;
+        for (size_t i = 0; i < n; ++i) {
+            v.push_back(static_cast<int>(i));
+            if (v.capacity() != lastCap) { lastCap = v.capacity(); ++reallocs; }
+        }
+        std::cout << "    [Perf] " << std::left << std::setw(12) << name
+                  << " reallocs: " << std::setw(4) << reallocs
+                  << " wasted: " << v.wasted_bytes() / 1024 << "KB\n";
+    };
+    myVector<int> d;
+    myVector<int, std::allocator<int>, myGrowthOneAndHalf> h;
+    myVector<int, std::allocator<int>, myGrowthGoldenRatio> g;
+    report("2x", d, N);
+    report("1.5x", h, N);
+    report("golden", g, N);
+    EXPECT_EQ(d.size(), h.size());
+}
+
 TEST(MyVectorTest, CustomAllocator) {
     // 验证 Allocator 是否被调用
     using Alloc = DebugAllocator<int>;
@@ -132,6 +355,210 @@ TEST(MyVectorTest, CustomAllocator) {
     EXPECT_TRUE(Alloc::dealloc_count > 0);
 }
 
+TEST(MyVectorTest, InPlaceReallocate) {
+    // 可重定位类型 + 提供 reallocate 扩展的分配器：扩容不再 "分配-拷贝-释放"
+    using Alloc = DebugAllocator<int>;
+    Alloc::alloc_count = Alloc::dealloc_count = Alloc::realloc_count = Alloc::inplace_count = 0;
+    {
+        myVector<int, Alloc> v;
+        for (int i = 0; i < 1000; ++i) v.push_back(i);
+        EXPECT_EQ(v[999], 999);
+        EXPECT_EQ(Alloc::alloc_count, 1);      // 仅首次分配
+        EXPECT_TRUE(Alloc::realloc_count >= 9); // 其余扩容均走 realloc
+    }
+    std::cout << "    [Perf] realloc: " << Alloc::realloc_count << ", in place: " << Alloc::inplace_count << "\n";
+
+    // 非平凡类型仍走 "分配-移动-释放"
+    DebugAllocator<std::string>::realloc_count = 0;
+    {
+        myVector<std::string, DebugAllocator<std::string>> s;
+        for (int i = 0; i < 20; ++i) s.push_back(std::to_string(i));
+        EXPECT_EQ(s[19], "19");
+    }
+    EXPECT_EQ(DebugAllocator<std::string>::realloc_count, 0);
+
+    // 大块跨越 mmap 阈值后由 mremap 重映射
+    myVector<HeavyPOD, myMallocAllocator<HeavyPOD>> big;
+    for (int i = 0; i < 100000; ++i) big.push_back(HeavyPOD(i));
+    EXPECT_EQ(big[0].data[0], 0);
+    EXPECT_EQ(big[99999].data[7], 99999);
+    big.erase(big.begin(), big.begin() + 50000);
+    EXPECT_EQ(big[0].data[0], 50000);
+}
+
+TEST(MyVectorTest, BulkEraseCompaction) {
+    myVector<int> v;
+    for (int i = 0; i < 20; ++i) v.push_back(i % 7);    // 0..6 0..6 0..5
+    EXPECT_EQ(erase_if(v, [](int x) { return x % 2 == 1; }), 9u);
+    EXPECT_EQ(v.size(), 11u);
+    bool even = true;
+    for (int x : v) even = even && x % 2 == 0;
+    EXPECT_TRUE(even);
+    EXPECT_EQ(erase(v, 4), 3u);
+    EXPECT_EQ(v.remove(v[0]), 3u);                         // 参数引用自身元素
+    EXPECT_EQ(v.size(), 5u);                               // 2 6 2 6 2
+    EXPECT_EQ(v.retain([](int x) { return x > 2; }), 3u);
+    EXPECT_EQ(v.size(), 2u);
+    EXPECT_EQ(v.erase_if([](int) { return false; }), 0u);
+
+    myVector<int> u = {1, 1, 2, 2, 2, 3, 1, 1, 4};
+    EXPECT_EQ(u.unique(), 4u);
+    const int uniq[] = {1, 2, 3, 1, 4};
+    EXPECT_EQ(u.size(), 5u);
+    EXPECT_TRUE(std::equal(u.begin(), u.end(), uniq));
+    // 二元谓词与 "上一个保留的元素" 比较：差值不超过 1 的相邻链只留第一个
+    myVector<int> chain = {1, 2, 3, 10, 11, 20};
+    chain.unique([](int prev, int x) { return x - prev <= 1; });
+    EXPECT_EQ(chain.size(), 4u);                           // 1 3 10 20
+    EXPECT_EQ(chain[1], 3);
+
+    // 非平凡类型：保留元素只移动不复制，被删元素与尾部各析构一次
+    Obj::resetStats();
+    {
+        myVector<Obj> objs;
+        objs.reserve(10);
+        for (int i = 0; i < 10; ++i) objs.emplace_back("o", i);
+        int moves = Obj::move_count;
+        EXPECT_EQ(objs.erase_if([](const Obj& o) { return o.id < 3 || o.id == 6; }), 4u);
+        EXPECT_EQ(objs.size(), 6u);
+        EXPECT_EQ(objs[0].id, 3);
+        EXPECT_EQ(objs[3].id, 7);
+        EXPECT_EQ(Obj::copy_count, 0);
+        EXPECT_EQ(Obj::move_count - moves, 6);             // 3 4 5 7 8 9 各移动一次
+        EXPECT_EQ(Obj::destruct_count, 4);
+    }
+    EXPECT_EQ(Obj::destruct_count, 10);                    // 移动赋值不产生新对象：构造 10 个，析构 10 个
+
+    // 可重定位但非平凡析构：被删元素就地析构，保留段整段搬移，不重复释放
+    myVector<RelocatableBox> boxes;
+    for (int i = 0; i < 10; ++i) boxes.emplace_back(i);
+    boxes.erase_if([](const RelocatableBox& b) { return *b.p % 3 == 0; });
+    EXPECT_EQ(boxes.size(), 6u);
+    EXPECT_EQ(*boxes[0].p, 1);
+    EXPECT_EQ(*boxes[5].p, 8);
+
+    // 谓词抛异常：已处理与未处理部分都保留为有效元素
+    myVector<std::string> strs = {"a", "bb", "c", "throw", "dd", "e"};
+    bool thrown = false;
+    try {
+        strs.erase_if([](const std::string& x) {
+            if (x == "throw") throw std::runtime_error("pred failed");
+            return x.size() == 1;
+        });
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+    EXPECT_EQ(strs.size(), 4u);                            // bb throw dd e
+    EXPECT_EQ(strs[0], "bb");
+    EXPECT_EQ(strs[3], "e");
+}
+
+TEST(MyVectorTest, ShrinkToFit) {
+    myVector<int> v;
+    for (int i = 0; i < 1000; ++i) v.push_back(i);
+    v.erase_if([](int x) { return x >= 10; });
+    EXPECT_TRUE(v.capacity() >= 1000u);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 10u);
+    EXPECT_EQ(v[9], 9);
+    v.clear();
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 0u);
+    v.push_back(1);
+    EXPECT_EQ(v[0], 1);
+
+    myVector<std::string> s;
+    for (int i = 0; i < 100; ++i) s.push_back(std::to_string(i));
+    s.retain([](const std::string& x) { return x.size() == 1; });
+    s.shrink_to_fit();
+    EXPECT_EQ(s.capacity(), 10u);
+    EXPECT_EQ(s[9], "9");
+
+    // 支持 reallocate 的分配器原地收缩
+    using Alloc = DebugAllocator<int>;
+    Alloc::realloc_count = 0;
+    myVector<int, Alloc> r;
+    for (int i = 0; i < 100; ++i) r.push_back(i);
+    int reallocs = Alloc::realloc_count;
+    r.remove(50);
+    r.shrink_to_fit();
+    EXPECT_EQ(Alloc::realloc_count - reallocs, 1);
+    EXPECT_EQ(r.capacity(), 99u);
+}
+
+TEST(MyVectorTest, CopyAssignmentReuse) {
+    myVector<Obj> src, dst;
+    for (int i = 0; i < 8; ++i) src.emplace_back("src", i);
+    for (int i = 0; i < 5; ++i) dst.emplace_back("dst", i);
+    dst.reserve(16);
+
+    // 变长：重叠的 5 个拷贝赋值，只拷贝构造多出的 3 个，不析构任何元素
+    Obj::resetStats();
+    dst = src;
+    EXPECT_EQ(dst.size(), 8u);
+    EXPECT_EQ(dst[7].id, 7);
+    EXPECT_EQ(dst[0].name, "src");
+    EXPECT_EQ(Obj::copy_count, 8);
+    EXPECT_EQ(Obj::destruct_count, 0);
+
+    // 变短：拷贝赋值 2 个，析构多余的 6 个
+    myVector<Obj> small;
+    small.emplace_back("small", 100);
+    small.emplace_back("small", 101);
+    Obj::resetStats();
+    dst = small;
+    EXPECT_EQ(dst.size(), 2u);
+    EXPECT_EQ(dst[1].id, 101);
+    EXPECT_EQ(Obj::copy_count, 2);
+    EXPECT_EQ(Obj::destruct_count, 6);
+    EXPECT_EQ(dst.capacity(), 16u);                        // 容量足够时保留原内存
+
+    // 容量不足：在恰好 size() 大小的新内存上构造，再销毁旧元素
+    myVector<Obj> tiny;
+    Obj::resetStats();
+    tiny = src;
+    EXPECT_EQ(tiny.size(), 8u);
+    EXPECT_EQ(tiny.capacity(), 8u);
+    EXPECT_EQ(Obj::copy_count, 8);
+
+    // 自赋值
+    tiny = static_cast<const myVector<Obj>&>(tiny);
+    EXPECT_EQ(tiny[3].id, 3);
+
+    // 平凡类型：容量足够时不分配
+    using Alloc = DebugAllocator<HeavyPOD>;
+    myVector<HeavyPOD, Alloc> a, b;
+    for (int i = 0; i < 100; ++i) a.push_back(HeavyPOD(i));
+    for (int i = 0; i < 200; ++i) b.push_back(HeavyPOD(-i));
+    int allocs = Alloc::alloc_count;
+    b = a;
+    EXPECT_EQ(Alloc::alloc_count, allocs);
+    EXPECT_EQ(b.size(), 100u);
+    EXPECT_EQ(b[99].data[7], 99);
+
+    // 拷贝构造失败时容量不足分支保持原内容不变（强保证）
+    struct Fragile {
+        int v;
+        explicit Fragile(int x) : v(x) {}
+        Fragile(const Fragile& o) : v(o.v) { if (o.v == 3) throw std::runtime_error("copy failed"); }
+        Fragile& operator=(const Fragile&) = default;
+    };
+    myVector<Fragile> fs, ft;
+    fs.reserve(5);                                         // 避免扩容时搬迁触发异常
+    for (int i = 0; i < 5; ++i) fs.emplace_back(i);
+    ft.emplace_back(42);
+    bool thrown = false;
+    try {
+        ft = fs;
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown);
+    EXPECT_EQ(ft.size(), 1u);
+    EXPECT_EQ(ft[0].v, 42);
+}
+
 TEST(MyVectorTest, IteratorTraits) {
     // 验证 vector 的迭代器是否符合 Random Access Iterator 要求
     myVector<int> v;
@@ -154,4 +581,96 @@ TEST(MyVectorTest, PerformanceComparison_Int) {
     EXPECT_TRUE(true); 
 }
 
+TEST(MyVectorTest, PerformanceDefaultInitResize) {
+    // 用 resize + 覆盖 与 resize_and_overwrite 填充同一大缓冲区
+    const size_t N = 20000000;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    myVector<int> a;
+    a.resize(N);
+    for (size_t i = 0; i < N; ++i) a[i] = static_cast<int>(i);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    myVector<int> b;
+    b.resize_and_overwrite(N, [](int* data, size_t n) {
+        for (size_t i = 0; i < n; ++i) data[i] = static_cast<int>(i);
+        return n;
+    });
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "    [Perf] resize+fill: " << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+              << "ms, resize_and_overwrite: " << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count() << "ms\n";
+    EXPECT_EQ(a[N - 1], b[N - 1]);
+}
+
+TEST(MyVectorTest, PerformanceInsertMiddle) {
+    // 中间插入/删除：平凡类型走一次 memmove 而非逐元素搬运
+    const size_t N = 20000;
+    auto start = std::chrono::high_resolution_clock::now();
+    myVector<int> v;
+    for (size_t i = 0; i < N; ++i) {
+        v.insert(v.begin() + v.size() / 2, static_cast<int>(i));
+    }
+    for (size_t i = 0; i < N; ++i) {
+        v.erase(v.begin() + v.size() / 2);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "    [Perf] myVector<int> middle insert/erase x" << N << ": "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms\n";
+    EXPECT_TRUE(v.empty());
+}
+
+TEST(MyVectorTest, PerformanceBulkErase) {
+    // 删除一半元素：逐个 erase 每次搬移整个尾部 O(N^2)，erase_if 单趟 O(N)
+    const size_t N = 100000;
+    myVector<int> a, b;
+    for (size_t i = 0; i < N; ++i) {
+        a.push_back(static_cast<int>(i));
+        b.push_back(static_cast<int>(i));
+    }
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int* it = a.begin(); it != a.end();) {
+        it = (*it % 2 == 1) ? a.erase(it) : it + 1;
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    erase_if(b, [](int x) { return x % 2 == 1; });
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "    [Perf] remove odd from " << N << " ints: erase loop "
+              << std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count() << "us, erase_if "
+              << std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count() << "us\n";
+    EXPECT_EQ(a.size(), b.size());
+    EXPECT_TRUE(std::equal(a.begin(), a.end(), b.begin()));
+}
+
+TEST(MyVectorTest, PerformanceCopyAssignment) {
+    // 每个 tick 用新快照刷新同一个 vector：复用已有元素与 string 缓冲区，而非 "析构全部 + 重新构造"
+    const int N = 2000, ticks = 500;
+    myVector<Obj> snapshot;
+    for (int i = 0; i < N; ++i) snapshot.emplace_back("a reasonably long name that defeats SSO #" + std::to_string(i), i);
+
+    Obj::resetStats();
+    myVector<Obj> rebuilt;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int t = 0; t < ticks; ++t) {
+        rebuilt.clear();                                    // 旧实现：clear 后逐个拷贝构造
+        rebuilt.assign(snapshot.begin(), snapshot.end());
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    int rebuiltDestructs = Obj::destruct_count;
+
+    Obj::resetStats();
+    myVector<Obj> reused;
+    auto t2 = std::chrono::high_resolution_clock::now();
+    for (int t = 0; t < ticks; ++t) {
+        reused = snapshot;
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+    int reusedDestructs = Obj::destruct_count;
+
+    std::cout << "    [Perf] refresh " << N << " Obj x" << ticks << ": clear + copy "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() << "ms (" << rebuiltDestructs
+              << " dtors), operator= " << std::chrono::duration_cast<std::chrono::milliseconds>(t3 - t2).count()
+              << "ms (" << reusedDestructs << " dtors)\n";
+    EXPECT_EQ(reusedDestructs, 0);
+    EXPECT_EQ(rebuiltDestructs, N * (ticks - 1));
+    EXPECT_EQ(reused[N - 1].id, N - 1);
+}
+
 #endif // TEST_MYVECTOR_HPP
\ No newline at end of file